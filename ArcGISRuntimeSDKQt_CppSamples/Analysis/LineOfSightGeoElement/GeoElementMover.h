@@ -0,0 +1,120 @@
+// [WriteFile Name=LineOfSightGeoElement, Category=Analysis]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef GEOELEMENTMOVER_H
+#define GEOELEMENTMOVER_H
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+class GeoElement;
+}
+}
+
+#include "Point.h"
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QString>
+
+#include <vector>
+
+class QTimer;
+
+// Moves GeoElements along routes of waypoints at a constant speed. Each route
+// is densified along the geodesic once, when it is set; every tick then only
+// interpolates between the precomputed vertices by the elapsed time, so one
+// timer can drive a large number of elements.
+class GeoElementMover : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit GeoElementMover(QObject* parent = nullptr);
+  ~GeoElementMover() override;
+
+  // adds an element that starts at its current position; returns its index
+  int addElement(Esri::ArcGISRuntime::GeoElement* element, double metersPerSecond);
+  int elementCount() const;
+
+  // replaces the element's route, starting from its current position. With
+  // loop set, the element cycles through the waypoints until the route changes.
+  void setRoute(int index, const QList<Esri::ArcGISRuntime::Point>& waypoints, bool loop = false);
+  void setSpeed(int index, double metersPerSecond);
+  bool isMoving(int index) const;
+
+  // attribute that receives the heading in degrees, e.g. for a renderer's heading expression
+  void setHeadingAttribute(const QString& attributeName);
+  // maximum turn rate in degrees per second; zero snaps to the direction of travel
+  void setTurnRate(double degreesPerSecond);
+  // maximum distance between the precomputed vertices
+  void setMaxSegmentLength(double meters);
+
+  // time spent moving all elements in a tick, averaged over the last report interval
+  double averageTickCost() const;
+  double maxTickCost() const;
+
+signals:
+  void arrived(int index);
+  void tickCostChanged();
+
+private:
+  struct PathVertex
+  {
+    double x = 0.0;
+    double y = 0.0;
+    // distance along the path from its first vertex, in meters
+    double distance = 0.0;
+    // heading of the segment that starts at this vertex
+    double heading = 0.0;
+  };
+
+  struct Track
+  {
+    Esri::ArcGISRuntime::GeoElement* element = nullptr;
+    std::vector<PathVertex> path;
+    double z = 0.0;
+    double speed = 0.0;
+    double travelled = 0.0;
+    std::size_t segment = 0;
+    // the looping part of the path starts at this vertex
+    std::size_t loopVertex = 0;
+    double heading = 0.0;
+    bool loop = false;
+    bool moving = false;
+  };
+
+  void tick();
+  void appendLeg(Track& track, const Esri::ArcGISRuntime::Point& from, const Esri::ArcGISRuntime::Point& to) const;
+  void updateElement(Track& track, double elapsedSeconds);
+  void recordTickCost(qint64 nsecs);
+
+  std::vector<Track> m_tracks;
+  QTimer* m_timer = nullptr;
+  QElapsedTimer m_clock;
+  QString m_headingAttribute = QStringLiteral("HEADING");
+  double m_turnRate = 0.0;
+  double m_maxSegmentLength = 2.0;
+  qint64 m_tickCostTotal = 0;
+  qint64 m_tickCostMax = 0;
+  int m_tickCount = 0;
+  double m_averageTickCost = 0.0;
+  double m_maxTickCost = 0.0;
+};
+
+#endif // GEOELEMENTMOVER_H
@@ -19,11 +19,11 @@
 #endif // PCH_BUILD
 
 #include "LineOfSightGeoElement.h"
+#include "GeoElementMover.h"
 
 #include "ArcGISSceneLayer.h"
 #include "ArcGISTiledElevationSource.h"
 #include "GeoElementLineOfSight.h"
-#include "GeometryEngine.h"
 #include "GraphicsOverlay.h"
 #include "ModelSceneSymbol.h"
 #include "PointBuilder.h"
@@ -32,8 +32,6 @@
 #include "SimpleMarkerSymbol.h"
 #include "SimpleRenderer.h"
 
-#include <array>
-
 #include <QDir>
 #include <QtCore/qglobal.h>
 
@@ -69,12 +67,15 @@ namespace
 const Point observationPoint(-73.9853, 40.7484, 200, SpatialReference::wgs84());
 
 // Waypoints around the block for taxi to drive.
-const std::array<Point, 4> waypoints = {{
-                                          { -73.984513, 40.748469, 2, SpatialReference::wgs84() },
-                                          { -73.985068, 40.747786, 2, SpatialReference::wgs84() },
-                                          { -73.983452, 40.747091, 2, SpatialReference::wgs84() },
-                                          { -73.982961, 40.747762, 2, SpatialReference::wgs84() }
-                                        }};
+const QList<Point> waypoints = {
+                                 { -73.984513, 40.748469, 2, SpatialReference::wgs84() },
+                                 { -73.985068, 40.747786, 2, SpatialReference::wgs84() },
+                                 { -73.983452, 40.747091, 2, SpatialReference::wgs84() },
+                                 { -73.982961, 40.747762, 2, SpatialReference::wgs84() }
+                               };
+
+// Taxi speed in metres per second.
+constexpr double taxiSpeed = 10.0;
 }
 
 LineOfSightGeoElement::LineOfSightGeoElement(QObject* parent /* = nullptr */):
@@ -93,9 +94,10 @@ LineOfSightGeoElement::LineOfSightGeoElement(QObject* parent /* = nullptr */):
         QUrl("https://tiles.arcgis.com/tiles/z2tnIkrLQ2BRzr6P/arcgis/rest/services/New_York_LoD2_3D_Buildings/SceneServer/layers/0"));
   m_scene->operationalLayers()->append(buildings);
 
-  // Trigger animation of taxi every 100ms.
-  m_animation.setInterval(100);
-  m_animation.callOnTimeout(this, &LineOfSightGeoElement::animate);
+  // The mover drives the taxi around the block and orients it using the `HEADING` attribute.
+  m_mover = new GeoElementMover(this);
+  m_mover->setHeadingAttribute("HEADING");
+  connect(m_mover, &GeoElementMover::tickCostChanged, this, &LineOfSightGeoElement::tickCostChanged);
 }
 
 LineOfSightGeoElement::~LineOfSightGeoElement() = default;
@@ -215,41 +217,15 @@ void LineOfSightGeoElement::initialize()
     Camera camera(observationPoint, 700, -30, 45, 0);
     m_sceneView->setViewpointCamera(camera, 0);
 
-    m_animation.start();
+    // Drive the taxi around the block, cycling through the waypoints.
+    const int taxiIndex = m_mover->addElement(m_taxi, taxiSpeed);
+    m_mover->setRoute(taxiIndex, waypoints, true);
   });
 
   taxiSymbol->load();
 }
 
-void LineOfSightGeoElement::animate()
+double LineOfSightGeoElement::tickCost() const
 {
-  // Goal point to travel to
-  Point waypoint = waypoints.at(m_waypointIndex);
-
-  // Calculate azimuth between current location and goal location for taxi.
-  Point location = geometry_cast<Point>(m_taxi->geometry());
-
-  if (!location.isValid())
-    return;
-
-  GeodeticDistanceResult distance = GeometryEngine::distanceGeodetic(
-        location, waypoint, LinearUnit::meters(), AngularUnit::degrees(), GeodeticCurveType::Geodesic);
-
-  // Move taxi one metre along the line between its current position and the goal location.
-  QList<Point> newPoints = GeometryEngine::moveGeodetic(
-  { location }, 1.0, LinearUnit::meters(), distance.azimuth1(), AngularUnit::degrees(), GeodeticCurveType::Geodesic);
-  if (newPoints.size() > 0)
-  {
-    location = newPoints.last();
-  }
-
-  // Update taxi position and orientation.
-  m_taxi->setGeometry(geometry_cast<Geometry>(location));
-  m_taxi->attributes()->replaceAttribute("HEADING", distance.azimuth1());
-
-  // When taxi is close enough to the waypoint then increment the index for a new goal next animation step.
-  // Index is cyclic and an element of [0, 3].
-  if (distance.distance() <= 2) {
-    m_waypointIndex = (m_waypointIndex + 1) % waypoints.size();
-  }
+  return m_mover->averageTickCost();
 }
@@ -28,7 +28,8 @@ class Graphic;
 }
 
 #include <QObject>
-#include <QTimer>
+
+class GeoElementMover;
 
 class LineOfSightGeoElement : public QObject
 {
@@ -36,6 +37,7 @@ class LineOfSightGeoElement : public QObject
 
     Q_PROPERTY(double heightZ READ heightZ WRITE setHeightZ NOTIFY heightZChanged)
     Q_PROPERTY(Esri::ArcGISRuntime::SceneQuickView* sceneView READ sceneView WRITE setSceneView NOTIFY sceneViewChanged)
+    Q_PROPERTY(double tickCost READ tickCost NOTIFY tickCostChanged)
 
 public:
     explicit LineOfSightGeoElement(QObject* parent = nullptr);
@@ -46,13 +48,12 @@ public:
 signals:
     void heightZChanged();
     void sceneViewChanged();
-
-private slots:
-    void animate();
+    void tickCostChanged();
 
 private:
     double heightZ() const;
     void setHeightZ(double z);
+    double tickCost() const;
 
     Esri::ArcGISRuntime::SceneQuickView* sceneView() const;
     void setSceneView(Esri::ArcGISRuntime::SceneQuickView* sceneView);
@@ -61,8 +62,7 @@ private:
     Esri::ArcGISRuntime::Scene* m_scene = nullptr;
     Esri::ArcGISRuntime::SceneQuickView* m_sceneView = nullptr;
 
-    QTimer m_animation;
-    std::size_t m_waypointIndex = 0;
+    GeoElementMover* m_mover = nullptr;
     Esri::ArcGISRuntime::Graphic* m_taxi = nullptr;
     Esri::ArcGISRuntime::Graphic* m_observer = nullptr;
 };
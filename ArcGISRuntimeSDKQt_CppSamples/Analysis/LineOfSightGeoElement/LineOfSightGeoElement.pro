@@ -33,10 +33,12 @@ include($$PWD/arcgisruntime.pri)
 #-------------------------------------------------------------------------------
 
 HEADERS += \
+    GeoElementMover.h \
     LineOfSightGeoElement.h
 
 SOURCES += \
     main.cpp \
+    GeoElementMover.cpp \
     LineOfSightGeoElement.cpp
 
 RESOURCES += LineOfSightGeoElement.qrc
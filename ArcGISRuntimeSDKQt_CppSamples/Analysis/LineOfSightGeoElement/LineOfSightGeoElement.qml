@@ -52,6 +52,24 @@ Item {
                 }
             }
         }
+
+        Rectangle {
+            anchors {
+                margins: 5
+                right: parent.right
+                top: parent.top
+            }
+            color: Qt.rgba(0.7, 0.7, 0.7, 0.7);
+            radius: 10
+            width: tickCostText.width + 10
+            height: tickCostText.height + 10
+
+            Text {
+                id: tickCostText
+                anchors.centerIn: parent
+                text: "Animation cost: %1 ms per frame".arg(model.tickCost.toFixed(3))
+            }
+        }
     }
 
     // Declare the C++ instance which creates the scene etc. and supply the view
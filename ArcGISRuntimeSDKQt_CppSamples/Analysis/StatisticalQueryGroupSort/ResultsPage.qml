@@ -19,6 +19,7 @@ Rectangle {
     signal backClicked()
 
     property var statisticResult
+    property string populationStatistics
 
     Column {
         anchors.fill: parent
@@ -78,7 +79,10 @@ Rectangle {
             ListView {
                 id: resultView
                 anchors {
-                    fill: parent
+                    left: parent.left
+                    right: parent.right
+                    top: parent.top
+                    bottom: populationText.top
                     margins: 10
                 }
                 model: statisticResult
@@ -112,6 +116,18 @@ Rectangle {
                     }
                 }
             }
+
+            // time taken to populate the model from the query result
+            Text {
+                id: populationText
+                anchors {
+                    left: parent.left
+                    bottom: parent.bottom
+                    margins: 10
+                }
+                text: populationStatistics
+                font.pixelSize: 12
+            }
         }
     }
 }
@@ -18,7 +18,9 @@
 #include <QVariant>
 #include <QFileInfo>
 #include <QDir>
-#include <QList>
+#include <QVector>
+
+#include <utility>
 
 #include "StatisticResultListModel.h"
 
@@ -37,11 +39,36 @@ void StatisticResultListModel::setupRoles()
 void StatisticResultListModel::addStatisticResult(const QString& section, const QString& statistic)
 {
   beginInsertRows(QModelIndex(), rowCount(), rowCount());
-  StatisticResult result(section, statistic);
-  m_results.append(result);
+  m_results.append(StatisticResult(section, statistic));
+  endInsertRows();
+}
+
+void StatisticResultListModel::appendStatisticResults(QVector<StatisticResult> results)
+{
+  if (results.isEmpty())
+    return;
+
+  if (m_results.isEmpty())
+  {
+    setStatisticResults(std::move(results));
+    return;
+  }
+
+  const int first = rowCount();
+  beginInsertRows(QModelIndex(), first, first + results.count() - 1);
+  m_results.reserve(first + results.count());
+  for (StatisticResult& result : results)
+    m_results.append(std::move(result));
   endInsertRows();
 }
 
+void StatisticResultListModel::setStatisticResults(QVector<StatisticResult> results)
+{
+  beginResetModel();
+  m_results = std::move(results);
+  endResetModel();
+}
+
 int StatisticResultListModel::rowCount(const QModelIndex& parent) const
 {
   Q_UNUSED(parent);
@@ -53,7 +80,7 @@ QVariant StatisticResultListModel::data(const QModelIndex& index, int role) cons
   if (index.row() < 0 || index.row() >= m_results.count())
     return QVariant();
 
-  StatisticResult result = m_results[index.row()];
+  const StatisticResult& result = m_results.at(index.row());
 
   QVariant retVal;
 
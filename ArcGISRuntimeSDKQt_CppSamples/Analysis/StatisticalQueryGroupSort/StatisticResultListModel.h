@@ -17,7 +17,7 @@
 #include <QAbstractListModel>
 #include <QByteArray>
 #include <QHash>
-#include <QList>
+#include <QVector>
 
 class StatisticResultListModel : public QAbstractListModel
 {
@@ -30,11 +30,27 @@ public:
     StatisticRole
   };
 
+  // Struct to keep track of the section and statistic strings
+  struct StatisticResult
+  {
+  public:
+    StatisticResult() = default;
+    StatisticResult(const QString& section, const QString& statistic);
+    ~StatisticResult() = default;
+
+    QString section;
+    QString statistic;
+  };
+
   explicit StatisticResultListModel(QObject* parent = nullptr);
   ~StatisticResultListModel() override = default;
 
 public:
   void addStatisticResult(const QString& section, const QString& statistic);
+  // inserts a whole result set in a single model transaction
+  void appendStatisticResults(QVector<StatisticResult> results);
+  // replaces the current results with a single model reset
+  void setStatisticResults(QVector<StatisticResult> results);
   void clear();
   void setupRoles();
   int size() { return m_results.size(); }
@@ -47,19 +63,8 @@ protected:
   QHash<int, QByteArray> roleNames() const override;
 
 private:
-  // Struct to keep track of the section and statistic strings
-  struct StatisticResult
-  {
-  public:
-    StatisticResult(const QString& section, const QString& statistic);
-    ~StatisticResult() = default;
-
-    QString section;
-    QString statistic;
-  };
-
   QHash<int, QByteArray> m_roles;
-  QList<StatisticResult> m_results;
+  QVector<StatisticResult> m_results;
 };
 
 #endif // STATISTICRESULTISTMODEL_H
@@ -29,10 +29,13 @@
 
 #include "StatisticResultListModel.h"
 
+#include <QElapsedTimer>
 #include <QStringList>
 #include <QVariantList>
 #include <QList>
+#include <QVector>
 #include <memory>
+#include <utility>
 
 using namespace Esri::ArcGISRuntime;
 
@@ -97,8 +100,10 @@ void StatisticalQueryGroupSort::connectSignals()
     if (!result)    
       return;    
 
-    // clear previous results
-    m_resultsModel->clear();
+    // collect all of the results so the model is populated in one reset
+    QElapsedTimer timer;
+    timer.start();
+    QVector<StatisticResultListModel::StatisticResult> results;
 
     // iterate the results and add to a model
     StatisticRecordIterator iter = result->iterator();
@@ -121,9 +126,17 @@ void StatisticalQueryGroupSort::connectSignals()
       for (auto it = statsMap.cbegin(); it != statsMap.cend(); ++it)
       {
         const QString statString = QString("%1: %2").arg(it.key(), it.value().toString());
-        addResultToModel(sectionString, statString);
+        results.append(StatisticResultListModel::StatisticResult(sectionString, statString));
       }
     }
+
+    // replace the previous results
+    m_populatedCount = results.count();
+    m_resultsModel->setStatisticResults(std::move(results));
+    emit resultsModelChanged();
+
+    m_populationTime = timer.nsecsElapsed() / 1.0e6;
+    emit populationStatisticsChanged();
   });
 }
 
@@ -321,3 +334,13 @@ QAbstractListModel* StatisticalQueryGroupSort::resultsModel() const
 {
   return m_resultsModel;
 }
+
+int StatisticalQueryGroupSort::populatedCount() const
+{
+  return m_populatedCount;
+}
+
+double StatisticalQueryGroupSort::populationTime() const
+{
+  return m_populationTime;
+}
@@ -45,6 +45,8 @@ class StatisticalQueryGroupSort : public QQuickItem
   Q_PROPERTY(QStringList statisticTypes MEMBER m_statisticTypes NOTIFY statisticTypesChanged)
   Q_PROPERTY(QStringList groupingFields MEMBER m_groupingFields NOTIFY groupingFieldsChanged)
   Q_PROPERTY(QAbstractListModel* resultsModel READ resultsModel NOTIFY resultsModelChanged)
+  Q_PROPERTY(int populatedCount READ populatedCount NOTIFY populationStatisticsChanged)
+  Q_PROPERTY(double populationTime READ populationTime NOTIFY populationStatisticsChanged)
 
 public:
   explicit StatisticalQueryGroupSort(QQuickItem* parent = nullptr);
@@ -69,9 +71,12 @@ signals:
   void statisticTypesChanged();
   void groupingFieldsChanged();
   void resultsModelChanged();
+  void populationStatisticsChanged();
 
 private:
   QAbstractListModel* resultsModel() const;
+  int populatedCount() const;
+  double populationTime() const;
   void connectSignals();
   Esri::ArcGISRuntime::StatisticType statisticStringToEnum(const QString& statistic) const;
   Esri::ArcGISRuntime::SortOrder orderStringToEnum(const QString& order) const;
@@ -84,6 +89,9 @@ private:
   QStringList m_statisticTypes;
   QStringList m_groupingFields;
   StatisticResultListModel* m_resultsModel = nullptr;
+  // number of rows and milliseconds taken to populate the model from the last query
+  int m_populatedCount = 0;
+  double m_populationTime = 0.0;
 };
 
 #endif // STATISTICALQUERYGROUPSORT_H
@@ -48,6 +48,7 @@ StatisticalQueryGroupSortSample {
             width: parent.width
             height: parent.height
             statisticResult: rootRectangle.resultsModel
+            populationStatistics: "Populated %1 results in %2 ms".arg(rootRectangle.populatedCount).arg(rootRectangle.populationTime.toFixed(1))
             onBackClicked: stackView.pop();
         }
     }
@@ -0,0 +1,341 @@
+// [WriteFile Name=ViewshedGeoElement, Category=Analysis]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "GeoElementMover.h"
+
+#include "AttributeListModel.h"
+#include "GeoElement.h"
+#include "GeometryEngine.h"
+#include "Polyline.h"
+#include "PolylineBuilder.h"
+
+#include <QTimer>
+#include <QtMath>
+
+#include <cmath>
+
+using namespace Esri::ArcGISRuntime;
+
+namespace
+{
+constexpr int tickInterval = 16;
+constexpr int ticksPerReport = 60;
+constexpr double earthRadius = 6371008.8;
+
+// great circle length and initial bearing between two nearby vertices
+double sphericalDistance(double x1, double y1, double x2, double y2)
+{
+  const double phi1 = qDegreesToRadians(y1);
+  const double phi2 = qDegreesToRadians(y2);
+  const double dPhi = phi2 - phi1;
+  const double dLambda = qDegreesToRadians(x2 - x1);
+  const double a = std::sin(dPhi / 2) * std::sin(dPhi / 2) +
+                   std::cos(phi1) * std::cos(phi2) * std::sin(dLambda / 2) * std::sin(dLambda / 2);
+  return 2 * earthRadius * std::atan2(std::sqrt(a), std::sqrt(1 - a));
+}
+
+double sphericalBearing(double x1, double y1, double x2, double y2)
+{
+  const double phi1 = qDegreesToRadians(y1);
+  const double phi2 = qDegreesToRadians(y2);
+  const double dLambda = qDegreesToRadians(x2 - x1);
+  const double bearing = std::atan2(std::sin(dLambda) * std::cos(phi2),
+                                    std::cos(phi1) * std::sin(phi2) - std::sin(phi1) * std::cos(phi2) * std::cos(dLambda));
+  return std::fmod(qRadiansToDegrees(bearing) + 360.0, 360.0);
+}
+
+// signed difference in (-180, 180]
+double headingDelta(double from, double to)
+{
+  double delta = std::fmod(to - from, 360.0);
+  if (delta > 180.0)
+    delta -= 360.0;
+  else if (delta <= -180.0)
+    delta += 360.0;
+  return delta;
+}
+
+Point toWgs84(const Geometry& geometry)
+{
+  const Point point = geometry_cast<Point>(geometry);
+  if (point.isEmpty() || point.spatialReference() == SpatialReference::wgs84())
+    return point;
+
+  return geometry_cast<Point>(GeometryEngine::project(point, SpatialReference::wgs84()));
+}
+} // namespace
+
+GeoElementMover::GeoElementMover(QObject* parent) :
+  QObject(parent),
+  m_timer(new QTimer(this))
+{
+  m_timer->setTimerType(Qt::PreciseTimer);
+  m_timer->setInterval(tickInterval);
+  connect(m_timer, &QTimer::timeout, this, &GeoElementMover::tick);
+}
+
+GeoElementMover::~GeoElementMover() = default;
+
+int GeoElementMover::addElement(GeoElement* element, double metersPerSecond)
+{
+  Track track;
+  track.element = element;
+  track.speed = metersPerSecond;
+
+  const Point position = toWgs84(element->geometry());
+  track.z = position.hasZ() ? position.z() : 0.0;
+
+  if (!m_headingAttribute.isEmpty())
+    track.heading = element->attributes()->attributeValue(m_headingAttribute).toDouble();
+
+  m_tracks.push_back(std::move(track));
+  return static_cast<int>(m_tracks.size()) - 1;
+}
+
+int GeoElementMover::elementCount() const
+{
+  return static_cast<int>(m_tracks.size());
+}
+
+void GeoElementMover::setRoute(int index, const QList<Point>& waypoints, bool loop)
+{
+  Track& track = m_tracks.at(index);
+  track.path.clear();
+  track.travelled = 0.0;
+  track.segment = 0;
+  track.loopVertex = 0;
+  track.loop = loop;
+  track.moving = false;
+
+  const Point start = toWgs84(track.element->geometry());
+  if (start.isEmpty() || waypoints.isEmpty())
+    return;
+
+  // the element keeps the height it started at; the overlay's surface
+  // placement decides what that height is relative to
+  track.path.push_back(PathVertex{start.x(), start.y(), 0.0, track.heading});
+
+  Point previous = start;
+  for (int i = 0; i < waypoints.size(); ++i)
+  {
+    const Point waypoint = toWgs84(waypoints.at(i));
+    appendLeg(track, previous, waypoint);
+    previous = waypoint;
+
+    if (i == 0)
+      track.loopVertex = track.path.size() - 1;
+  }
+
+  if (loop)
+    appendLeg(track, previous, toWgs84(waypoints.first()));
+
+  if (track.path.size() < 2 || track.path.back().distance <= 0.0)
+  {
+    track.path.clear();
+    return;
+  }
+
+  // looping back onto a single waypoint has no length to cycle over
+  if (track.loop && track.path.back().distance - track.path.at(track.loopVertex).distance <= 0.0)
+    track.loop = false;
+
+  track.moving = true;
+  if (!m_timer->isActive())
+  {
+    m_clock.start();
+    m_timer->start();
+  }
+}
+
+void GeoElementMover::setSpeed(int index, double metersPerSecond)
+{
+  m_tracks.at(index).speed = metersPerSecond;
+}
+
+bool GeoElementMover::isMoving(int index) const
+{
+  return m_tracks.at(index).moving;
+}
+
+void GeoElementMover::setHeadingAttribute(const QString& attributeName)
+{
+  m_headingAttribute = attributeName;
+}
+
+void GeoElementMover::setTurnRate(double degreesPerSecond)
+{
+  m_turnRate = degreesPerSecond;
+}
+
+void GeoElementMover::setMaxSegmentLength(double meters)
+{
+  m_maxSegmentLength = meters;
+}
+
+double GeoElementMover::averageTickCost() const
+{
+  return m_averageTickCost;
+}
+
+double GeoElementMover::maxTickCost() const
+{
+  return m_maxTickCost;
+}
+
+// densifies a leg along the geodesic and appends its vertices to the path
+void GeoElementMover::appendLeg(Track& track, const Point& from, const Point& to) const
+{
+  const GeodeticDistanceResult leg = GeometryEngine::distanceGeodetic(from, to, LinearUnit::meters(), AngularUnit::degrees(),
+                                                                      GeodeticCurveType::Geodesic);
+  if (leg.distance() <= 0.0)
+    return;
+
+  PolylineBuilder builder(SpatialReference::wgs84());
+  builder.addPoint(from.x(), from.y());
+  builder.addPoint(to.x(), to.y());
+  const Polyline dense = geometry_cast<Polyline>(GeometryEngine::densifyGeodetic(builder.toGeometry(), m_maxSegmentLength,
+                                                                                 LinearUnit::meters(), GeodeticCurveType::Geodesic));
+  const ImmutablePart part = dense.parts().part(0);
+
+  // the spherical lengths of the short segments are scaled to the leg's
+  // geodesic length, so distances along the path stay exact at the waypoints
+  std::vector<double> lengths;
+  lengths.reserve(part.pointCount());
+  double sphericalLength = 0.0;
+  for (int i = 1; i < part.pointCount(); ++i)
+  {
+    const Point a = part.point(i - 1);
+    const Point b = part.point(i);
+    lengths.push_back(sphericalDistance(a.x(), a.y(), b.x(), b.y()));
+    sphericalLength += lengths.back();
+  }
+  const double scale = sphericalLength > 0.0 ? leg.distance() / sphericalLength : 0.0;
+
+  double distance = track.path.back().distance;
+  for (int i = 1; i < part.pointCount(); ++i)
+  {
+    const Point a = part.point(i - 1);
+    const Point b = part.point(i);
+    track.path.back().heading = sphericalBearing(a.x(), a.y(), b.x(), b.y());
+    distance += lengths.at(i - 1) * scale;
+    track.path.push_back(PathVertex{b.x(), b.y(), distance, track.path.back().heading});
+  }
+}
+
+void GeoElementMover::tick()
+{
+  const double elapsedSeconds = m_clock.nsecsElapsed() / 1.0e9;
+  m_clock.start();
+
+  QElapsedTimer cost;
+  cost.start();
+
+  QList<int> arrivals;
+  bool anyMoving = false;
+  for (std::size_t i = 0; i < m_tracks.size(); ++i)
+  {
+    Track& track = m_tracks[i];
+    if (!track.moving)
+      continue;
+
+    updateElement(track, elapsedSeconds);
+
+    if (track.moving)
+      anyMoving = true;
+    else
+      arrivals.append(static_cast<int>(i));
+  }
+
+  recordTickCost(cost.nsecsElapsed());
+
+  if (!anyMoving)
+    m_timer->stop();
+
+  for (int index : arrivals)
+    emit arrived(index);
+}
+
+void GeoElementMover::updateElement(Track& track, double elapsedSeconds)
+{
+  const double length = track.path.back().distance;
+  track.travelled += track.speed * elapsedSeconds;
+
+  if (track.travelled >= length)
+  {
+    if (track.loop)
+    {
+      const double loopStart = track.path.at(track.loopVertex).distance;
+      track.travelled = loopStart + std::fmod(track.travelled - loopStart, length - loopStart);
+      track.segment = track.loopVertex;
+    }
+    else
+    {
+      track.travelled = length;
+      track.moving = false;
+    }
+  }
+
+  // the distance only increases, so the current segment is found by walking forward
+  const std::size_t lastSegment = track.path.size() - 2;
+  while (track.segment < lastSegment && track.path[track.segment + 1].distance <= track.travelled)
+    ++track.segment;
+
+  const PathVertex& a = track.path[track.segment];
+  const PathVertex& b = track.path[track.segment + 1];
+  const double span = b.distance - a.distance;
+  const double t = span > 0.0 ? qBound(0.0, (track.travelled - a.distance) / span, 1.0) : 1.0;
+
+  track.element->setGeometry(Point(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, track.z, SpatialReference::wgs84()));
+
+  if (m_headingAttribute.isEmpty())
+    return;
+
+  // turn towards the direction of travel, limited by the turn rate
+  double delta = headingDelta(track.heading, a.heading);
+  if (m_turnRate > 0.0)
+  {
+    const double maxTurn = m_turnRate * elapsedSeconds;
+    delta = qBound(-maxTurn, delta, maxTurn);
+  }
+  if (delta == 0.0)
+    return;
+
+  track.heading = std::fmod(track.heading + delta + 360.0, 360.0);
+  AttributeListModel* attributes = track.element->attributes();
+  if (attributes->containsAttribute(m_headingAttribute))
+    attributes->replaceAttribute(m_headingAttribute, track.heading);
+  else
+    attributes->insertAttribute(m_headingAttribute, track.heading);
+}
+
+void GeoElementMover::recordTickCost(qint64 nsecs)
+{
+  m_tickCostTotal += nsecs;
+  m_tickCostMax = qMax(m_tickCostMax, nsecs);
+  if (++m_tickCount < ticksPerReport)
+    return;
+
+  m_averageTickCost = m_tickCostTotal / 1.0e6 / m_tickCount;
+  m_maxTickCost = m_tickCostMax / 1.0e6;
+  m_tickCostTotal = 0;
+  m_tickCostMax = 0;
+  m_tickCount = 0;
+  emit tickCostChanged();
+}
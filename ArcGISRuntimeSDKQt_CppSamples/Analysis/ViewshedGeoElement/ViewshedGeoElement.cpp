@@ -19,6 +19,7 @@
 #endif // PCH_BUILD
 
 #include "ViewshedGeoElement.h"
+#include "GeoElementMover.h"
 
 #include "ArcGISTiledElevationSource.h"
 #include "Scene.h"
@@ -30,10 +31,8 @@
 #include "SimpleRenderer.h"
 #include "ModelSceneSymbol.h"
 #include "GeoElementViewshed.h"
-#include "GeometryEngine.h"
 #include "OrbitGeoElementCameraController.h"
 
-#include <QTimer>
 #include <QString>
 #include <QUrl>
 #include <QVariant>
@@ -64,6 +63,10 @@ namespace
 
     return dataPath;
   }
+
+  // the tank drives at 10 m/s and turns at up to 90 degrees per second
+  constexpr double tankSpeed = 10.0;
+  constexpr double tankTurnRate = 90.0;
 } // namespace
 
 ViewshedGeoElement::ViewshedGeoElement(QQuickItem* parent /* = nullptr */):
@@ -131,16 +134,18 @@ void ViewshedGeoElement::componentComplete()
   followingController->setCameraPitchOffset(45.0);
   m_sceneView->setCameraController(followingController);
 
-  // Create a Timer
-  m_timer = new QTimer(this);
-  m_timer->setInterval(100);
-  connect(m_timer, &QTimer::timeout, this, &ViewshedGeoElement::animate);
+  // Create the mover that drives the tank
+  m_mover = new GeoElementMover(this);
+  m_mover->setHeadingAttribute(m_headingAttr);
+  m_mover->setTurnRate(tankTurnRate);
+  m_tankIndex = m_mover->addElement(m_tank, tankSpeed);
+  connect(m_mover, &GeoElementMover::tickCostChanged, this, &ViewshedGeoElement::tickCostChanged);
 
   // connect to the mouse clicked signal
   connect(m_sceneView, &SceneQuickView::mouseClicked, this, [this](QMouseEvent& event)
   {
-    m_waypoint = m_sceneView->screenToBaseSurface(event.x(), event.y());
-    m_timer->start();
+    const Point waypoint = m_sceneView->screenToBaseSurface(event.x(), event.y());
+    m_mover->setRoute(m_tankIndex, QList<Point>{waypoint});
   });
 }
 
@@ -183,32 +188,7 @@ void ViewshedGeoElement::createGraphic()
   m_graphicsOverlay->graphics()->append(m_tank);
 }
 
-void ViewshedGeoElement::animate()
+double ViewshedGeoElement::tickCost() const
 {
-  if (m_waypoint.isEmpty())
-    return;
-
-  // get current location and distance from waypoint
-  Point location = m_tank->geometry();
-  const GeodeticDistanceResult distance = GeometryEngine::distanceGeodetic(location, m_waypoint,
-                                                                           m_linearUnit, m_angularUnit,
-                                                                           m_curveType);
-
-  // move toward waypoint based on speed and update orientation
-  location = GeometryEngine::moveGeodetic(QList<Point>{location}, 1.0, m_linearUnit,
-                                          distance.azimuth1(), m_angularUnit,
-                                          m_curveType).at(0);
-  m_tank->setGeometry(location);
-
-  // update the heading
-  const double heading = m_tank->attributes()->attributeValue(m_headingAttr).toDouble();
-  const QString newHeading = QString::number(heading + (distance.azimuth1() - heading) / 10);
-  m_tank->attributes()->replaceAttribute(m_headingAttr, newHeading);
-
-  // reached waypoint
-  if (distance.distance() <= 5)
-  {
-    m_waypoint = Point();
-    m_timer->stop();
-  }
+  return m_mover ? m_mover->averageTickCost() : 0.0;
 }
@@ -29,15 +29,16 @@ class Graphic;
 }
 }
 
-#include "Point.h"
-#include "GeometryTypes.h"
 #include <QQuickItem>
-#include <QTimer>
+
+class GeoElementMover;
 
 class ViewshedGeoElement : public QQuickItem
 {
   Q_OBJECT
 
+  Q_PROPERTY(double tickCost READ tickCost NOTIFY tickCostChanged)
+
 public:
   explicit ViewshedGeoElement(QQuickItem* parent = nullptr);
   ~ViewshedGeoElement() override = default;
@@ -45,25 +46,23 @@ public:
   void componentComplete() override;
   static void init();
 
-private slots:
-  void animate();
+signals:
+  void tickCostChanged();
 
 private:
   void createGraphicsOverlay();
   void createGraphic();
+  double tickCost() const;
 
   Esri::ArcGISRuntime::SceneQuickView* m_sceneView = nullptr;
   Esri::ArcGISRuntime::AnalysisOverlay* m_analysisOverlay = nullptr;
   Esri::ArcGISRuntime::GeoElementViewshed* m_viewshed = nullptr;
   Esri::ArcGISRuntime::GraphicsOverlay* m_graphicsOverlay = nullptr;
   Esri::ArcGISRuntime::Graphic* m_tank = nullptr;
-  Esri::ArcGISRuntime::Point m_waypoint;
-  Esri::ArcGISRuntime::LinearUnitId m_linearUnit = Esri::ArcGISRuntime::LinearUnitId::Meters;
-  Esri::ArcGISRuntime::AngularUnitId m_angularUnit = Esri::ArcGISRuntime::AngularUnitId::Degrees;
-  Esri::ArcGISRuntime::GeodeticCurveType m_curveType = Esri::ArcGISRuntime::GeodeticCurveType::Geodesic;
+  GeoElementMover* m_mover = nullptr;
+  int m_tankIndex = -1;
 
   const QString m_headingAttr = QStringLiteral("HEADING");
-  QTimer* m_timer = nullptr;
 };
 
 #endif // VIEWSHEDGEOELEMENT_H
@@ -33,10 +33,12 @@ include($$PWD/arcgisruntime.pri)
 #-------------------------------------------------------------------------------
 
 HEADERS += \
+    GeoElementMover.h \
     ViewshedGeoElement.h
 
 SOURCES += \
     main.cpp \
+    GeoElementMover.cpp \
     ViewshedGeoElement.cpp
 
 RESOURCES += ViewshedGeoElement.qrc
@@ -27,4 +27,23 @@ ViewshedGeoElementSample {
         objectName: "sceneView"
         anchors.fill: parent
     }
+
+    Rectangle {
+        anchors {
+            left: parent.left
+            top: parent.top
+            margins: 10
+        }
+        width: tickCostText.width + 10
+        height: tickCostText.height + 10
+        color: "white"
+        opacity: 0.8
+        radius: 5
+
+        Text {
+            id: tickCostText
+            anchors.centerIn: parent
+            text: "Animation cost: %1 ms per frame".arg(tickCost.toFixed(3))
+        }
+    }
 }
@@ -28,12 +28,30 @@
 #include "Point.h"
 #include "AnalysisOverlay.h"
 
+#include <QQuickWindow>
+#include <cmath>
 
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+// size in pixels of the screen cells the drag location snaps to in coarse preview
+constexpr double coarseCellSize = 16.0;
+
+QPointF snapToCoarseCell(const QPointF& screenPoint)
+{
+  return QPointF((std::floor(screenPoint.x() / coarseCellSize) + 0.5) * coarseCellSize,
+                 (std::floor(screenPoint.y() / coarseCellSize) + 0.5) * coarseCellSize);
+}
+}
+
 ViewshedLocation::ViewshedLocation(QQuickItem* parent /* = nullptr */):
   QQuickItem(parent)
 {
+  connect(this, &QQuickItem::windowChanged, this, &ViewshedLocation::onWindowChanged);
+
+  m_statsTimer.setInterval(1000);
+  connect(&m_statsTimer, &QTimer::timeout, this, &ViewshedLocation::updateRecomputeStats);
 }
 
 void ViewshedLocation::init()
@@ -68,6 +86,9 @@ void ViewshedLocation::componentComplete()
 
   // connect signals
   connectSignals();
+
+  m_statsTimer.start();
+  updateRecomputeStats();
 }
 
 void ViewshedLocation::setInitialViewpoint()
@@ -92,10 +113,7 @@ void ViewshedLocation::connectSignals()
     if (!m_locationViewshed)
       createViewshed(event.x(), event.y());
     else
-    {
-      const Point pt = m_sceneView->screenToBaseSurface(event.x(), event.y());
-      m_locationViewshed->setLocation(pt);
-    }
+      requestLocation(event.localPos(), false);
   });
 
   connect(m_sceneView, &SceneQuickView::mousePressedAndHeld, this, [this](QMouseEvent& event)
@@ -109,15 +127,19 @@ void ViewshedLocation::connectSignals()
   connect(m_sceneView, &SceneQuickView::mouseMoved, this, [this](QMouseEvent& event)
   {
     if (m_calculating)
-    {
-      const Point pt = m_sceneView->screenToBaseSurface(event.x(), event.y());
-      m_locationViewshed->setLocation(pt);
-    }
+      requestLocation(event.localPos(), m_coarsePreview);
   });
 
-  connect(m_sceneView, &SceneQuickView::mouseReleased, this, [this]
+  connect(m_sceneView, &SceneQuickView::mouseReleased, this, [this](QMouseEvent& event)
   {
+    if (!m_calculating)
+      return;
+
     m_calculating = false;
+
+    // recompute at the exact release position without waiting for the next frame
+    requestLocation(event.localPos(), false);
+    applyPendingChanges();
   });
 }
 
@@ -134,9 +156,88 @@ void ViewshedLocation::createViewshed(double x, double y)
   // Add the Viewshed to the Analysis Overlay
   m_analysisOverlay->analyses()->append(m_locationViewshed);
 
+  m_pendingScreenPoint = QPointF(x, y);
+  ++m_recomputes;
+  ++m_totalRecomputes;
+
   return;
 }
 
+void ViewshedLocation::onWindowChanged(QQuickWindow* window)
+{
+  disconnect(m_frameConnection);
+
+  if (window)
+    m_frameConnection = connect(window, &QQuickWindow::afterAnimating, this, &ViewshedLocation::applyPendingChanges);
+}
+
+// Records the latest drag position. The viewshed itself is only moved once per frame.
+void ViewshedLocation::requestLocation(const QPointF& screenPoint, bool coarse)
+{
+  ++m_inputEvents;
+
+  const QPointF target = coarse ? snapToCoarseCell(screenPoint) : screenPoint;
+  if (target == m_pendingScreenPoint)
+    return;
+
+  m_pendingScreenPoint = target;
+  m_locationPending = true;
+  scheduleUpdate();
+}
+
+void ViewshedLocation::scheduleUpdate()
+{
+  if (window())
+    window()->update();
+  else
+    applyPendingChanges();
+}
+
+// Applies at most one location, heading and pitch change to the viewshed.
+void ViewshedLocation::applyPendingChanges()
+{
+  if (!m_locationViewshed || !(m_locationPending || m_headingPending || m_pitchPending))
+    return;
+
+  if (m_locationPending)
+  {
+    const Point pt = m_sceneView->screenToBaseSurface(m_pendingScreenPoint.x(), m_pendingScreenPoint.y());
+    m_locationViewshed->setLocation(pt);
+    m_locationPending = false;
+  }
+
+  if (m_headingPending)
+  {
+    m_locationViewshed->setHeading(m_heading);
+    m_headingPending = false;
+  }
+
+  if (m_pitchPending)
+  {
+    m_locationViewshed->setPitch(m_pitch);
+    m_pitchPending = false;
+  }
+
+  ++m_recomputes;
+  ++m_totalRecomputes;
+}
+
+void ViewshedLocation::updateRecomputeStats()
+{
+  const QString stats = QString("%1 input events/s, %2 viewshed updates/s (%3 total)")
+                          .arg(m_inputEvents)
+                          .arg(m_recomputes)
+                          .arg(m_totalRecomputes);
+  m_inputEvents = 0;
+  m_recomputes = 0;
+
+  if (stats == m_recomputeStats)
+    return;
+
+  m_recomputeStats = stats;
+  emit recomputeStatsChanged();
+}
+
 // Getters/Setters for each Q_PROPERTY
 bool ViewshedLocation::isViewshedVisible() const
 {
@@ -296,27 +397,24 @@ void ViewshedLocation::setVerticalAngle(double verticalAngle)
   emit verticalAngleChanged();
 }
 
+// heading and pitch are applied to the viewshed on the next frame
 double ViewshedLocation::heading() const
 {
-  return m_locationViewshed ? m_locationViewshed->heading() : m_heading;
+  return m_heading;
 }
 
 void ViewshedLocation::setHeading(double heading)
 {
-  if (m_locationViewshed)
-  {
-    if (m_locationViewshed->heading() == heading)
-      return;
+  if (m_heading == heading)
+    return;
 
-    m_heading = heading;
-    m_locationViewshed->setHeading(heading);
-  }
-  else
-  {
-    if (m_heading == heading)
-      return;
+  m_heading = heading;
 
-    m_heading = heading;
+  if (m_locationViewshed)
+  {
+    ++m_inputEvents;
+    m_headingPending = true;
+    scheduleUpdate();
   }
 
   emit headingChanged();
@@ -324,25 +422,21 @@ void ViewshedLocation::setHeading(double heading)
 
 double ViewshedLocation::pitch() const
 {
-  return m_locationViewshed ? m_locationViewshed->pitch() : m_pitch;
+  return m_pitch;
 }
 
 void ViewshedLocation::setPitch(double pitch)
 {
-  if (m_locationViewshed)
-  {
-    if (m_locationViewshed->pitch() == pitch)
-      return;
+  if (m_pitch == pitch)
+    return;
 
-    m_pitch = pitch;
-    m_locationViewshed->setPitch(pitch);
-  }
-  else
-  {
-    if (m_pitch == pitch)
-      return;
+  m_pitch = pitch;
 
-    m_pitch = pitch;
+  if (m_locationViewshed)
+  {
+    ++m_inputEvents;
+    m_pitchPending = true;
+    scheduleUpdate();
   }
 
   emit pitchChanged();
@@ -377,3 +471,22 @@ void ViewshedLocation::setObstructedColor(const QColor& obstructedColor)
 
   emit obstructedColorChanged();
 }
+
+bool ViewshedLocation::isCoarsePreview() const
+{
+  return m_coarsePreview;
+}
+
+void ViewshedLocation::setCoarsePreview(bool coarsePreview)
+{
+  if (m_coarsePreview == coarsePreview)
+    return;
+
+  m_coarsePreview = coarsePreview;
+  emit coarsePreviewChanged();
+}
+
+QString ViewshedLocation::recomputeStats() const
+{
+  return m_recomputeStats;
+}
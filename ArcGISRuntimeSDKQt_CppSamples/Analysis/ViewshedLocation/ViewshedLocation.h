@@ -29,6 +29,8 @@ class AnalysisOverlay;
 
 #include <QQuickItem>
 #include <QColor>
+#include <QPointF>
+#include <QTimer>
 
 class ViewshedLocation : public QQuickItem
 {
@@ -51,6 +53,8 @@ public:
   Q_PROPERTY(double pitch READ pitch WRITE setPitch NOTIFY pitchChanged)
   Q_PROPERTY(QColor visibleColor READ visibleColor WRITE setVisibleColor NOTIFY visibleColorChanged)
   Q_PROPERTY(QColor obstructedColor READ obstructedColor WRITE setObstructedColor NOTIFY obstructedColorChanged)
+  Q_PROPERTY(bool coarsePreview READ isCoarsePreview WRITE setCoarsePreview NOTIFY coarsePreviewChanged)
+  Q_PROPERTY(QString recomputeStats READ recomputeStats NOTIFY recomputeStatsChanged)
 
   bool isViewshedVisible() const;
   void setViewshedVisible(bool viewshedVisible);
@@ -82,6 +86,11 @@ public:
   QColor obstructedColor() const;
   void setObstructedColor(const QColor& obstructedColor);
 
+  bool isCoarsePreview() const;
+  void setCoarsePreview(bool coarsePreview);
+
+  QString recomputeStats() const;
+
 signals:
   void viewshedVisibleChanged();
   void frustumVisibleChanged();
@@ -93,11 +102,18 @@ signals:
   void pitchChanged();
   void visibleColorChanged();
   void obstructedColorChanged();
+  void coarsePreviewChanged();
+  void recomputeStatsChanged();
 
 private:
   void connectSignals();
   void setInitialViewpoint();
   void createViewshed(double x, double y);
+  void onWindowChanged(QQuickWindow* window);
+  void requestLocation(const QPointF& screenPoint, bool coarse);
+  void scheduleUpdate();
+  void applyPendingChanges();
+  void updateRecomputeStats();
 
   Esri::ArcGISRuntime::SceneQuickView* m_sceneView = nullptr;
   Esri::ArcGISRuntime::LocationViewshed* m_locationViewshed = nullptr;
@@ -112,6 +128,21 @@ private:
   double m_heading = 0;
   double m_pitch = 90;
   bool m_calculating = false;
+
+  // viewshed changes waiting for the next rendered frame
+  QMetaObject::Connection m_frameConnection;
+  QPointF m_pendingScreenPoint;
+  bool m_locationPending = false;
+  bool m_headingPending = false;
+  bool m_pitchPending = false;
+  bool m_coarsePreview = false;
+
+  // recompute frequency instrumentation
+  QTimer m_statsTimer;
+  int m_inputEvents = 0;
+  int m_recomputes = 0;
+  qint64 m_totalRecomputes = 0;
+  QString m_recomputeStats;
 };
 
 #endif // VIEWSHEDLOCATION_H
@@ -162,6 +162,35 @@ ViewshedLocationSample {
                         }
                     }
 
+                    Item {
+                        width: parent.width
+                        height: 25
+
+                        Text {
+                            anchors.verticalCenter: parent.verticalCenter
+                            width: parent.width * 0.75
+                            text: qsTr("Coarse Preview While Dragging")
+                            font.pixelSize: 14
+                        }
+
+                        Switch {
+                            anchors {
+                                right: parent.right
+                                margins: 10
+                                verticalCenter: parent.verticalCenter
+                            }
+                            checked: viewshedSample.coarsePreview
+                            onCheckedChanged: viewshedSample.coarsePreview = checked;
+                        }
+                    }
+
+                    Text {
+                        width: parent.width
+                        text: viewshedSample.recomputeStats
+                        wrapMode: Text.WordWrap
+                        font.pixelSize: 12
+                    }
+
                     ViewshedSlider {
                         titleText: qsTr("Min Distance (m)")
                         parameterValue: viewshedSample.minDistance
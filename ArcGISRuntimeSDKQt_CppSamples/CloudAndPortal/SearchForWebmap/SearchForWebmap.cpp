@@ -24,15 +24,31 @@
 #include "PortalItem.h"
 #include "PortalItemListModel.h"
 #include "PortalQueryParametersForItems.h"
+#include "PortalQueryResultSetForItems.h"
 #include "SearchForWebmap.h"
+#include "WebmapSearchSession.h"
 
 #include <QDate>
 
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+  // Set SEARCHFORWEBMAP_PORTAL_URL to search another portal, such as a local
+  // mock portal server used to measure paging throughput offline.
+  Portal* createPortal(QObject* parent)
+  {
+    const QString portalUrl = qEnvironmentVariable("SEARCHFORWEBMAP_PORTAL_URL");
+    if (portalUrl.isEmpty())
+      return new Portal(parent);
+
+    return new Portal(QUrl(portalUrl), parent);
+  }
+}
+
 SearchForWebmap::SearchForWebmap(QQuickItem* parent /* = nullptr */):
   QQuickItem(parent),
-  m_portal(new Portal(this))
+  m_portal(createPortal(this))
 {
   AuthenticationManager::instance()->setCredentialCacheEnabled(false);
 }
@@ -57,15 +73,16 @@ void SearchForWebmap::componentComplete()
       emit portalLoadedChanged();
     });
 
-    //! [SearchForWebmap CPP Portal find items completed]
-    connect(m_portal, &Portal::findItemsCompleted, this, [this](PortalQueryResultSetForItems *webmapResults)
+    m_searchSession = new WebmapSearchSession(m_portal, this);
+    connect(m_searchSession, &WebmapSearchSession::currentPageChanged, this, [this]()
     {
-      m_webmapResults = webmapResults;
-      m_webmaps = m_webmapResults->itemResults();
+      m_webmapResults = m_searchSession->currentPage();
+      m_webmaps = m_webmapResults ? m_webmapResults->itemResults() : nullptr;
       emit webmapsChanged();
       emit hasMoreResultsChanged();
     });
-    //! [SearchForWebmap CPP Portal find items completed]
+
+    connect(m_searchSession, &WebmapSearchSession::statisticsChanged, this, &SearchForWebmap::searchStatisticsChanged);
 
     m_portal->load();
   }
@@ -96,9 +113,19 @@ QString SearchForWebmap::mapLoadError() const
   return m_mapLoadeError;
 }
 
+double SearchForWebmap::pagesPerSecond() const
+{
+  return m_searchSession ? m_searchSession->pagesPerSecond() : 0.0;
+}
+
+int SearchForWebmap::cachedPageCount() const
+{
+  return m_searchSession ? m_searchSession->cachedPageCount() : 0;
+}
+
 void SearchForWebmap::search(const QString keyword)
 {
-  if (!m_portal)
+  if (!m_portal || !m_searchSession)
     return;
 
   //! [SearchForWebmap CPP Portal find items]
@@ -112,7 +139,8 @@ void SearchForWebmap::search(const QString keyword)
                         .arg(keyword, fromDate, toDate));
   query.setTypes(QList<PortalItemType>() << PortalItemType::WebMap);
 
-  m_portal->findItems(query);
+  // the session serves repeated keywords from its cache and prefetches the following pages
+  m_searchSession->search(keyword, query);
   //! [SearchForWebmap CPP Portal find items]
 
   if(m_mapView)
@@ -121,15 +149,11 @@ void SearchForWebmap::search(const QString keyword)
 
 void SearchForWebmap::searchNext()
 {
-  if (!m_webmapResults || !m_portal)
+  if (!m_webmapResults || !m_searchSession)
     return;
 
-  //! [Portal find with nextQueryParameters]
-  PortalQueryParametersForItems nextQuery = m_webmapResults->nextQueryParameters();
-  // check whether the startIndex of the new query is valid
-  if (nextQuery.startIndex() != -1)
-    m_portal->findItems(nextQuery);
-  //! [Portal find with nextQueryParameters]
+  // the session requests the page with nextQueryParameters, unless it has already been prefetched
+  m_searchSession->showNextPage();
 }
 
 void SearchForWebmap::loadSelectedWebmap(int index)
@@ -140,8 +164,14 @@ void SearchForWebmap::loadSelectedWebmap(int index)
    if (m_map)
      delete m_map;
 
+   // cached result pages are released when they expire, so the map gets its own portal item
+   if (m_selectedItem)
+     delete m_selectedItem;
+
+   m_selectedItem = new PortalItem(m_portal, m_webmaps->at(index)->itemId(), this);
+
    // create map from portal item
-   m_map = new Map(m_webmaps->at(index), this);
+   m_map = new Map(m_selectedItem, this);
 
    connect(m_map,&Map::errorOccurred, this, [this]()
    {
@@ -31,6 +31,8 @@ namespace Esri
 #include <QAbstractListModel>
 #include <QQuickItem>
 
+class WebmapSearchSession;
+
 class SearchForWebmap : public QQuickItem
 {
   Q_OBJECT
@@ -39,6 +41,8 @@ class SearchForWebmap : public QQuickItem
   Q_PROPERTY(QAbstractListModel* webmaps READ webmaps NOTIFY webmapsChanged)
   Q_PROPERTY(bool hasMoreResults READ hasMoreResults NOTIFY hasMoreResultsChanged)
   Q_PROPERTY(QString mapLoadError READ mapLoadError NOTIFY mapLoadErrorChanged)
+  Q_PROPERTY(double pagesPerSecond READ pagesPerSecond NOTIFY searchStatisticsChanged)
+  Q_PROPERTY(int cachedPageCount READ cachedPageCount NOTIFY searchStatisticsChanged)
 
 public:
   explicit SearchForWebmap(QQuickItem* parent = nullptr);
@@ -51,6 +55,8 @@ public:
   QAbstractListModel* webmaps() const;
   bool hasMoreResults() const;
   QString mapLoadError() const;
+  double pagesPerSecond() const;
+  int cachedPageCount() const;
 
   Q_INVOKABLE void search(const QString keyword);
   Q_INVOKABLE void searchNext();
@@ -62,11 +68,13 @@ signals:
   void webmapsChanged();
   void hasMoreResultsChanged();
   void mapLoadErrorChanged();
+  void searchStatisticsChanged();
 
 private:
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   Esri::ArcGISRuntime::Portal* m_portal = nullptr;
+  WebmapSearchSession* m_searchSession = nullptr;
   Esri::ArcGISRuntime::PortalQueryResultSetForItems* m_webmapResults = nullptr;
   Esri::ArcGISRuntime::PortalItemListModel* m_webmaps = nullptr;
   Esri::ArcGISRuntime::PortalItem* m_selectedItem = nullptr;
@@ -46,9 +46,9 @@ TARGET = SearchForWebmap
 
 #-------------------------------------------------------------------------------
 
-HEADERS += SearchForWebmap.h
+HEADERS += SearchForWebmap.h WebmapSearchSession.h
 
-SOURCES += main.cpp SearchForWebmap.cpp
+SOURCES += main.cpp SearchForWebmap.cpp WebmapSearchSession.cpp
 
 RESOURCES += SearchForWebmap.qrc
 
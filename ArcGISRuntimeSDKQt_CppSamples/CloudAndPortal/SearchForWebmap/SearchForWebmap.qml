@@ -135,6 +135,17 @@ SearchForWebmapSample {
             text: "More Results"
             onClicked: searchNext();
         }
+
+        Text {
+            anchors {
+                margins: 10
+                bottom: parent.bottom
+                left: parent.left
+            }
+            text: "cached pages: " + cachedPageCount + ", pages/s: " + pagesPerSecond.toFixed(1)
+            color: "grey"
+            font.pointSize: 8
+        }
     }
 
     Column {
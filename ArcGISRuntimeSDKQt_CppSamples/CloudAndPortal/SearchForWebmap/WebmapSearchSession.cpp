@@ -0,0 +1,243 @@
+// [WriteFile Name=SearchForWebmap, Category=CloudAndPortal]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "WebmapSearchSession.h"
+
+#include "Portal.h"
+#include "PortalItem.h"
+#include "PortalItemListModel.h"
+#include "PortalQueryParametersForItems.h"
+#include "PortalQueryResultSetForItems.h"
+
+using namespace Esri::ArcGISRuntime;
+
+WebmapSearchSession::WebmapSearchSession(Portal* portal, QObject* parent /* = nullptr */):
+  QObject(parent),
+  m_portal(portal)
+{
+  //! [SearchForWebmap CPP Portal find items completed]
+  connect(m_portal, &Portal::findItemsCompleted, this, &WebmapSearchSession::handlePage);
+  //! [SearchForWebmap CPP Portal find items completed]
+
+  // a failed request leaves its search incomplete, so the page is fetched
+  // again the next time it is needed
+  connect(m_portal, &Portal::errorOccurred, this, [this]()
+  {
+    for (CachedSearch& search : m_searches)
+      search.fetching = false;
+
+    m_waitingForNextPage = false;
+  });
+}
+
+WebmapSearchSession::~WebmapSearchSession() = default;
+
+void WebmapSearchSession::setPrefetchDepth(int pages)
+{
+  m_prefetchDepth = qMax(0, pages);
+  prefetch();
+}
+
+void WebmapSearchSession::setTimeToLive(int msecs)
+{
+  m_timeToLive = msecs;
+}
+
+void WebmapSearchSession::search(const QString& key, const PortalQueryParametersForItems& query)
+{
+  evictExpired();
+
+  m_currentKey = key;
+  m_currentPage = 0;
+  m_waitingForNextPage = false;
+
+  CachedSearch& search = m_searches[key];
+  if (!search.age.isValid())
+    search.age.start();
+
+  // a search that failed before returning any pages is tried again
+  if (search.pages.isEmpty() && !search.fetching)
+  {
+    search.complete = false;
+    fetch(key, query);
+  }
+
+  // cached pages are shown straight away; otherwise the first page is shown when it arrives
+  emit currentPageChanged();
+  prefetch();
+}
+
+void WebmapSearchSession::showNextPage()
+{
+  auto it = m_searches.constFind(m_currentKey);
+  if (it == m_searches.constEnd())
+    return;
+
+  if (m_currentPage + 1 < it->pages.size())
+  {
+    ++m_currentPage;
+    emit currentPageChanged();
+    prefetch();
+    return;
+  }
+
+  // keep showing the current page until the next one arrives
+  if (!it->complete)
+  {
+    m_waitingForNextPage = true;
+    prefetch();
+  }
+}
+
+PortalQueryResultSetForItems* WebmapSearchSession::currentPage() const
+{
+  auto it = m_searches.constFind(m_currentKey);
+  if (it == m_searches.constEnd() || m_currentPage < 0 || m_currentPage >= it->pages.size())
+    return nullptr;
+
+  return it->pages.at(m_currentPage);
+}
+
+int WebmapSearchSession::cachedPageCount() const
+{
+  int count = 0;
+  for (const CachedSearch& search : m_searches)
+    count += search.pages.size();
+
+  return count;
+}
+
+double WebmapSearchSession::pagesPerSecond() const
+{
+  return m_fetchTime > 0 ? m_fetchedPages * 1000.0 / m_fetchTime : 0.0;
+}
+
+void WebmapSearchSession::handlePage(PortalQueryResultSetForItems* page)
+{
+  if (!page)
+    return;
+
+  m_fetchTime += m_fetchTimer.elapsed();
+  ++m_fetchedPages;
+
+  const QString key = m_keysBySearchString.value(page->queryParameters().searchString());
+  auto it = m_searches.find(key);
+  if (it == m_searches.end())
+  {
+    // the search was evicted while this page was being fetched
+    page->deleteLater();
+    emit statisticsChanged();
+    prefetch();
+    return;
+  }
+
+  // the session owns cached pages, so they are released when their search expires
+  page->setParent(this);
+  it->pages.append(page);
+  it->fetching = false;
+  it->complete = page->nextQueryParameters().startIndex() == -1;
+
+  // thumbnails are kept by the items, so cached pages also keep their thumbnails
+  PortalItemListModel* items = page->itemResults();
+  for (int i = 0; items && i < items->rowCount(); ++i)
+  {
+    PortalItem* item = items->at(i);
+    if (item && item->thumbnail().isNull())
+      item->fetchThumbnail();
+  }
+
+  if (key == m_currentKey)
+  {
+    if (m_waitingForNextPage)
+    {
+      m_waitingForNextPage = false;
+      ++m_currentPage;
+    }
+
+    if (m_currentPage == it->pages.size() - 1)
+      emit currentPageChanged();
+  }
+
+  emit statisticsChanged();
+  prefetch();
+}
+
+// Requests the next page of the current search while fewer than the prefetch
+// depth of pages are cached beyond the one being shown.
+void WebmapSearchSession::prefetch()
+{
+  auto it = m_searches.find(m_currentKey);
+  if (it == m_searches.end() || it->fetching || it->complete || it->pages.isEmpty())
+    return;
+
+  if (it->pages.size() > m_currentPage + m_prefetchDepth)
+    return;
+
+  //! [Portal find with nextQueryParameters]
+  // the last page has no next page when the startIndex of its next query is -1
+  fetch(m_currentKey, it->pages.last()->nextQueryParameters());
+  //! [Portal find with nextQueryParameters]
+}
+
+void WebmapSearchSession::fetch(const QString& key, const PortalQueryParametersForItems& query)
+{
+  CachedSearch& search = m_searches[key];
+  search.fetching = true;
+  m_keysBySearchString.insert(query.searchString(), key);
+
+  m_fetchTimer.start();
+  m_portal->findItems(query);
+}
+
+void WebmapSearchSession::evictExpired()
+{
+  for (auto it = m_searches.begin(); it != m_searches.end();)
+  {
+    // pages that are still being fetched are dropped when they arrive
+    if (it->age.hasExpired(m_timeToLive))
+    {
+      release(it.value());
+      it = m_searches.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  for (auto it = m_keysBySearchString.begin(); it != m_keysBySearchString.end();)
+  {
+    if (m_searches.contains(it.value()))
+      ++it;
+    else
+      it = m_keysBySearchString.erase(it);
+  }
+
+  emit statisticsChanged();
+}
+
+void WebmapSearchSession::release(CachedSearch& search)
+{
+  // the page being shown may still be referenced by the view until it is replaced
+  for (PortalQueryResultSetForItems* page : search.pages)
+    page->deleteLater();
+
+  search.pages.clear();
+}
@@ -0,0 +1,90 @@
+// [WriteFile Name=SearchForWebmap, Category=CloudAndPortal]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef WEBMAPSEARCHSESSION_H
+#define WEBMAPSEARCHSESSION_H
+
+namespace Esri
+{
+  namespace ArcGISRuntime
+  {
+    class Portal;
+    class PortalQueryParametersForItems;
+    class PortalQueryResultSetForItems;
+  }
+}
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QObject>
+
+// Runs keyword searches against a portal one page at a time, fetching the
+// next pages in the background before they are asked for. The pages of each
+// search are cached by keyword until they are older than the time to live,
+// so repeating a search shows its results without going back to the portal.
+class WebmapSearchSession : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit WebmapSearchSession(Esri::ArcGISRuntime::Portal* portal, QObject* parent = nullptr);
+  ~WebmapSearchSession() override;
+
+  void setPrefetchDepth(int pages);
+  void setTimeToLive(int msecs);
+
+  void search(const QString& key, const Esri::ArcGISRuntime::PortalQueryParametersForItems& query);
+  void showNextPage();
+
+  Esri::ArcGISRuntime::PortalQueryResultSetForItems* currentPage() const;
+  int cachedPageCount() const;
+  double pagesPerSecond() const;
+
+signals:
+  void currentPageChanged();
+  void statisticsChanged();
+
+private:
+  struct CachedSearch
+  {
+    QList<Esri::ArcGISRuntime::PortalQueryResultSetForItems*> pages;
+    QElapsedTimer age;
+    bool fetching = false;
+    bool complete = false;
+  };
+
+  void handlePage(Esri::ArcGISRuntime::PortalQueryResultSetForItems* page);
+  void prefetch();
+  void fetch(const QString& key, const Esri::ArcGISRuntime::PortalQueryParametersForItems& query);
+  void evictExpired();
+  void release(CachedSearch& search);
+
+  Esri::ArcGISRuntime::Portal* m_portal = nullptr;
+  int m_prefetchDepth = 3;
+  int m_timeToLive = 5 * 60 * 1000;
+  QHash<QString, CachedSearch> m_searches;
+  // the portal reports pages by their query, so map each query back to the search it belongs to
+  QHash<QString, QString> m_keysBySearchString;
+  QString m_currentKey;
+  int m_currentPage = -1;
+  bool m_waitingForNextPage = false;
+  int m_fetchedPages = 0;
+  qint64 m_fetchTime = 0;
+  QElapsedTimer m_fetchTimer;
+};
+
+#endif // WEBMAPSEARCHSESSION_H
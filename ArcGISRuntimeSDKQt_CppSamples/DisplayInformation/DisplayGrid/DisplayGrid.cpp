@@ -34,6 +34,23 @@
 
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+  // the text symbol style that is shared by all labels
+  constexpr float labelSize = 14.0f;
+  const QColor labelHaloColor("white");
+
+  QString lineSymbolKey(SimpleLineSymbolStyle style, const QColor& color, float width)
+  {
+    return QStringLiteral("%1|%2|%3").arg(static_cast<int>(style)).arg(color.name(QColor::HexArgb)).arg(width);
+  }
+
+  QString textSymbolKey(const QColor& color, float size, const QColor& haloColor, float haloWidth)
+  {
+    return QStringLiteral("%1|%2|%3|%4").arg(color.name(QColor::HexArgb)).arg(size).arg(haloColor.name(QColor::HexArgb)).arg(haloWidth);
+  }
+}
+
 const QString DisplayGrid::s_utmGrid = QStringLiteral("UTM");
 const QString DisplayGrid::s_usngGrid = QStringLiteral("USNG");
 const QString DisplayGrid::s_latlonGrid = QStringLiteral("LatLon");
@@ -80,30 +97,38 @@ void DisplayGrid::componentComplete()
 // change the grid type
 void DisplayGrid::changeGrid(const QString& gridType)
 {
+  Grid* grid = nullptr;
   if (gridType == latlonGrid())
   {
     //! [DisplayGrid Set_LatLon_Grid_Cpp]
     // create a grid for showing Latitude and Longitude (Meridians and Parallels)
-    LatitudeLongitudeGrid* latlonGrid = new LatitudeLongitudeGrid(this);
-    m_mapView->setGrid(latlonGrid);
+    grid = new LatitudeLongitudeGrid(this);
     //! [DisplayGrid Set_LatLon_Grid_Cpp]
   }
   else if (gridType == utmGrid())
   {
-    UTMGrid* utmGrid = new UTMGrid(this);
-    m_mapView->setGrid(utmGrid);
+    grid = new UTMGrid(this);
   }
   else if (gridType == usngGrid())
   {
-    USNGGrid* utmGrid = new USNGGrid(this);
-    m_mapView->setGrid(utmGrid);
+    grid = new USNGGrid(this);
   }
   else if (gridType == mgrsGrid())
   {
-    MGRSGrid* utmGrid = new MGRSGrid(this);
-    m_mapView->setGrid(utmGrid);
+    grid = new MGRSGrid(this);
   }
 
+  if (!grid)
+    return;
+
+  m_mapView->setGrid(grid);
+
+  // release the grid that was replaced; its symbols belong to the cache and are not affected
+  if (m_grid)
+    m_grid->deleteLater();
+
+  m_grid = grid;
+
   // apply any styling that has been set
   changeGridColor(currentGridColor());
   changeLabelColor(currentLabelColor());
@@ -125,7 +150,7 @@ void DisplayGrid::changeGridColor(const QString& color)
     for (int level = 0; level < gridLevels; level++)
     {
       const float width = 1 + level;
-      SimpleLineSymbol* lineSym = new SimpleLineSymbol(SimpleLineSymbolStyle::Solid, QColor(color), width, this);
+      SimpleLineSymbol* lineSym = lineSymbol(QColor(color), width);
       m_mapView->grid()->setLineSymbol(level, lineSym);
     }
     //! [DisplayGrid Set_Grid_Lines_Cpp]
@@ -145,10 +170,7 @@ void DisplayGrid::changeLabelColor(const QString& color)
     //! [DisplayGrid Set_Grid_Labels_Cpp]
     for (int level = 0; level < gridLevels; level++)
     {
-      constexpr float size = 14.0f;
-      TextSymbol* textSym = new TextSymbol("text", QColor(color), size, HorizontalAlignment::Left, VerticalAlignment::Bottom, this);
-      textSym->setHaloColor(QColor("white"));
-      textSym->setHaloWidth(2.0f + level);
+      TextSymbol* textSym = textSymbol(QColor(color), 2.0f + level);
       m_mapView->grid()->setTextSymbol(level, textSym);
     }
     //! [DisplayGrid Set_Grid_Labels_Cpp]
@@ -225,6 +247,58 @@ void DisplayGrid::changeLabelPosition(const QString& position)
   }
 }
 
+// return the shared line symbol for this style, creating it on first use
+SimpleLineSymbol* DisplayGrid::lineSymbol(const QColor& color, float width)
+{
+  constexpr SimpleLineSymbolStyle style = SimpleLineSymbolStyle::Solid;
+  const QString key = lineSymbolKey(style, color, width);
+
+  SimpleLineSymbol* symbol = m_lineSymbols.value(key, nullptr);
+  if (!symbol)
+  {
+    symbol = new SimpleLineSymbol(style, color, width, this);
+    m_lineSymbols.insert(key, symbol);
+    trackSymbol(symbol);
+  }
+
+  return symbol;
+}
+
+// return the shared text symbol for this style, creating it on first use
+TextSymbol* DisplayGrid::textSymbol(const QColor& color, float haloWidth)
+{
+  const QString key = textSymbolKey(color, labelSize, labelHaloColor, haloWidth);
+
+  TextSymbol* symbol = m_textSymbols.value(key, nullptr);
+  if (!symbol)
+  {
+    symbol = new TextSymbol("text", color, labelSize, HorizontalAlignment::Left, VerticalAlignment::Bottom, this);
+    symbol->setHaloColor(labelHaloColor);
+    symbol->setHaloWidth(haloWidth);
+    m_textSymbols.insert(key, symbol);
+    trackSymbol(symbol);
+  }
+
+  return symbol;
+}
+
+void DisplayGrid::trackSymbol(QObject* symbol)
+{
+  ++m_liveSymbolCount;
+  emit liveSymbolCountChanged();
+
+  connect(symbol, &QObject::destroyed, this, [this]()
+  {
+    --m_liveSymbolCount;
+    emit liveSymbolCountChanged();
+  });
+}
+
+int DisplayGrid::liveSymbolCount() const
+{
+  return m_liveSymbolCount;
+}
+
 MapQuickView* DisplayGrid::mapQuickView() const
 {
   return m_mapView;
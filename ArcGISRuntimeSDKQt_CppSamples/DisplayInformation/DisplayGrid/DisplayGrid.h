@@ -21,11 +21,15 @@ namespace Esri
 {
   namespace ArcGISRuntime
   {
+    class Grid;
     class Map;
     class MapQuickView;
+    class SimpleLineSymbol;
+    class TextSymbol;
   }
 }
 
+#include <QHash>
 #include <QQuickItem>
 
 class DisplayGrid : public QQuickItem
@@ -53,6 +57,7 @@ class DisplayGrid : public QQuickItem
   Q_PROPERTY(QString currentLabelPosition READ currentLabelPosition WRITE setCurrentLabelPosition NOTIFY currentLabelPositionChanged)
   Q_PROPERTY(bool gridVisibility READ gridVisibility WRITE setGridVisibility NOTIFY gridVisibilityChanged)
   Q_PROPERTY(bool gridLabelVisibility READ gridLabelVisibility WRITE setGridLabelVisibility NOTIFY gridLabelVisibilityChanged)
+  Q_PROPERTY(int liveSymbolCount READ liveSymbolCount NOTIFY liveSymbolCountChanged)
 
 public:
   explicit DisplayGrid(QQuickItem* parent = nullptr);
@@ -87,6 +92,7 @@ signals:
   void gridVisibilityChanged();
   void gridLabelVisibilityChanged();
   void mapQuickViewChanged();
+  void liveSymbolCountChanged();
 
 private:
     static const QString utmGrid() { return s_utmGrid; }
@@ -116,10 +122,19 @@ private:
     void setGridVisibility(bool visible);
     bool gridLabelVisibility();
     void setGridLabelVisibility(bool visible);
+    int liveSymbolCount() const;
+    Esri::ArcGISRuntime::SimpleLineSymbol* lineSymbol(const QColor& color, float width);
+    Esri::ArcGISRuntime::TextSymbol* textSymbol(const QColor& color, float haloWidth);
+    void trackSymbol(QObject* symbol);
 
 private:
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
+  Esri::ArcGISRuntime::Grid* m_grid = nullptr;
+  // symbols are immutable once created and shared by every level and grid type using the same style
+  QHash<QString, Esri::ArcGISRuntime::SimpleLineSymbol*> m_lineSymbols;
+  QHash<QString, Esri::ArcGISRuntime::TextSymbol*> m_textSymbols;
+  int m_liveSymbolCount = 0;
   static const QString s_utmGrid;
   static const QString s_usngGrid;
   static const QString s_latlonGrid;
@@ -272,6 +272,13 @@ DisplayGridSample {
                 }
             }
 
+            Text {
+                Layout.leftMargin: 10
+                Layout.columnSpan: 2
+                text: "Live symbols: " + liveSymbolCount
+                color: "#474747"
+            }
+
             // Button to hide the styling window
             Rectangle {
                 id: hideButton
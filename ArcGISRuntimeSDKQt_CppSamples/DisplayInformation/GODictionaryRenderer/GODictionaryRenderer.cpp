@@ -26,9 +26,11 @@
 #include "MapQuickView.h"
 #include "PolygonBuilder.h"
 #include "MultipointBuilder.h"
+#include "PointCollection.h"
 #include "DictionarySymbolStyle.h"
 
 #include <QDir>
+#include <QThread>
 #include <QtCore/qglobal.h>
 
 #ifdef Q_OS_IOS
@@ -54,18 +56,41 @@ namespace
 
     return dataPath;
   }
-} // namespace
 
-const QString GODictionaryRenderer::FIELD_CONTROL_POINTS = QStringLiteral("_control_points");
-const QString GODictionaryRenderer::FIELD_WKID = QStringLiteral("_wkid");
+  // number of messages parsed into each batch of graphics
+  constexpr int messageBatchSize = 500;
+} // namespace
 
 GODictionaryRenderer::GODictionaryRenderer(QQuickItem* parent) :
   QQuickItem(parent),
-  m_dataPath(defaultDataPath() + "/ArcGIS/Runtime/Data")
+  m_dataPath(defaultDataPath() + "/ArcGIS/Runtime/Data"),
+  m_readerThread(new QThread(this)),
+  m_reader(new MilMessageReader)
 {
+  // The XML is parsed on a worker thread; the graphics are created and
+  // appended on this thread, one batch at a time
+  m_reader->moveToThread(m_readerThread);
+  connect(m_readerThread, &QThread::finished, m_reader, &QObject::deleteLater);
+  connect(m_reader, &MilMessageReader::batchReady, this, &GODictionaryRenderer::appendMessages);
+  connect(m_reader, &MilMessageReader::finished, this, &GODictionaryRenderer::loadingFinished);
+  connect(m_reader, &MilMessageReader::progressChanged, this, [this](double progress)
+  {
+    m_loadProgress = progress;
+    emit loadProgressChanged();
+  });
+  connect(m_reader, &MilMessageReader::errorOccurred, this, [](const QString& message)
+  {
+    qWarning() << message;
+  });
+  m_readerThread->start();
 }
 
-GODictionaryRenderer::~GODictionaryRenderer() = default;
+GODictionaryRenderer::~GODictionaryRenderer()
+{
+  m_reader->cancel();
+  m_readerThread->quit();
+  m_readerThread->wait();
+}
 
 void GODictionaryRenderer::init()
 {
@@ -78,6 +103,21 @@ bool GODictionaryRenderer::graphicsLoaded() const
   return m_graphicsLoaded;
 }
 
+double GODictionaryRenderer::loadProgress() const
+{
+  return m_loadProgress;
+}
+
+int GODictionaryRenderer::messageCount() const
+{
+  return m_messageCount;
+}
+
+double GODictionaryRenderer::messagesPerSecond() const
+{
+  return m_messagesPerSecond;
+}
+
 void GODictionaryRenderer::componentComplete()
 {
   QQuickItem::componentComplete();    
@@ -98,8 +138,8 @@ void GODictionaryRenderer::componentComplete()
   m_mapView = findChild<MapQuickView*>("mapView");
   m_map = new Map(BasemapStyle::ArcGISTopographic, this);
 
-  parseXmlFile();
   m_mapView->graphicsOverlays()->append(m_graphicsOverlay);
+  parseXmlFile();
 
   // The GraphicsOverlay will not have a valid extent until it is part of
   // a MapQuickView with a valid spatial referenence
@@ -113,116 +153,78 @@ void GODictionaryRenderer::componentComplete()
 
 void GODictionaryRenderer::parseXmlFile()
 {
-  bool readingMessage = false;
-  QVariantMap elementValues;
-  QString currentElementName;
+  m_loadClock.start();
+  QMetaObject::invokeMethod(m_reader, "readFile", Qt::QueuedConnection,
+                            Q_ARG(QString, m_dataPath + "/xml/arcade_style/Mil2525DMessages.xml"),
+                            Q_ARG(int, messageBatchSize));
+}
 
-  QFile xmlFile(m_dataPath + "/xml/arcade_style/Mil2525DMessages.xml");
-  // Open the file for reading
-  if (xmlFile.isOpen())
-  {
-    xmlFile.reset();
-  }
-  else
-  {
-    xmlFile.open(QIODevice::ReadOnly | QIODevice::Text);
-  }
-  m_xmlParser.setDevice(&xmlFile);
+void GODictionaryRenderer::appendMessages(const MilMessageReader::MessageBatch& batch)
+{
+  QList<Graphic*> graphics;
+  graphics.reserve(batch.size());
 
-  // Traverse the XML in a loop
-  while (!m_xmlParser.atEnd())
+  for (const MilMessageReader::Message& message : batch)
   {
-    m_xmlParser.readNext();
-
-    // Is this the start or end of a message element?
-    if (m_xmlParser.name() == "message")
-    {
-      if (!readingMessage)
-      {
-        // This is the start of a message element.
-        elementValues.clear();
-      }
-      else
-      {
-        /**
-                 * This is the end of a message element. Here we have a complete message that defines
-                 * a military feature to display on the map. Create a graphic from its attributes.
-                 */
-        createGraphic(elementValues);
-      }
-      // Either we just started reading a message, or we just finished reading a message.
-      readingMessage = !readingMessage;
-    }
-    // Are we already inside a message element?
-    else if (readingMessage)
-    {
-      // Is this the start of an element inside a message?
-      if (m_xmlParser.isStartElement())
-      {
-        // Remember which element we're reading
-        currentElementName = m_xmlParser.name().toString();
-      }
-      // Is this text?
-      else if (m_xmlParser.isCharacters())
-      {
-        // Is this text inside an element?
-        if (!currentElementName.isEmpty())
-        {
-          // Get the text and store it as the current element's value
-          QStringRef trimmedText = m_xmlParser.text().trimmed();
-          if (!trimmedText.isEmpty())
-          {
-            elementValues[currentElementName] = trimmedText.toString();
-          }
-        }
-      }
-    }
+    const Geometry geom = createGeometry(message);
+    if (!geom.isEmpty())
+      graphics.append(new Graphic(geom, message.attributes, this));
   }
 
-  emit graphicsLoadedChanged();
+  // let the reader parse the next batch while this one is added to the overlay
+  m_reader->batchConsumed();
+
+  // append the whole batch at once rather than one graphic at a time
+  m_graphicsOverlay->graphics()->append(graphics);
+
+  m_messageCount += batch.size();
+  const qint64 elapsedMs = m_loadClock.elapsed();
+  m_messagesPerSecond = elapsedMs > 0 ? m_messageCount * 1000.0 / elapsedMs : 0.0;
+  emit messageCountChanged();
 }
 
-void GODictionaryRenderer::createGraphic(QVariantMap rawAttributes)
+Geometry GODictionaryRenderer::createGeometry(const MilMessageReader::Message& message)
 {
-  // If _wkid was absent, use WGS 1984 (4326) by default.
-  int wkid = rawAttributes.count(FIELD_WKID) > 0 ? rawAttributes[FIELD_WKID].toInt() : 4326;
-  SpatialReference sr(wkid);
-  Geometry geom;
-  QStringList pointStrings = rawAttributes[FIELD_CONTROL_POINTS].toString().split(";");
-  if (pointStrings.length() == 1)
+  const SpatialReference sr(message.wkid);
+  if (message.points.size() == 1)
   {
     // It's a point
-    QStringList coords = pointStrings[0].split(",");
-    geom = Point(coords[0].toDouble(), coords[1].toDouble(), sr);
-  }
-  else {
-    // It's a multipoint
-    MultipointBuilder* builder = new MultipointBuilder(sr, this);
-    PointCollection* collection = new PointCollection(sr, this);
-    for (const QString& pointString : pointStrings)
-    {
-      QStringList coords = pointString.split(",");
-      if (coords.length() >= 2)
-        collection->addPoint(coords[0].toDouble(), coords[1].toDouble());
-    }
-    builder->setPoints(collection);
-    geom = builder->toGeometry();
+    return Point(message.points[0].x(), message.points[0].y(), sr);
   }
 
-  if (!geom.isEmpty())
+  // It's a multipoint. Builders are reused per spatial reference instead of
+  // allocating a new builder and point collection for every message.
+  MultipointParts& parts = m_multipointParts[message.wkid];
+  if (!parts.builder)
   {
-    // Get rid of _control_points and _wkid. They are not needed in the graphic's
-    // attributes.
-    rawAttributes.remove(FIELD_CONTROL_POINTS);
-    rawAttributes.remove(FIELD_WKID);
-
-    Graphic* graphic = new Graphic(geom, rawAttributes, this);
-    m_graphicsOverlay->graphics()->append(graphic);
+    parts.builder = new MultipointBuilder(sr, this);
+    parts.points = new PointCollection(sr, this);
   }
+
+  parts.points->removeAll();
+  for (const QPointF& point : message.points)
+    parts.points->addPoint(point.x(), point.y());
+
+  parts.builder->setPoints(parts.points);
+  return parts.builder->toGeometry();
+}
+
+void GODictionaryRenderer::loadingFinished()
+{
+  m_loadProgress = 1.0;
+  emit loadProgressChanged();
+
+  m_graphicsLoaded = true;
+  emit graphicsLoadedChanged();
+
+  // zoom now if the view already has a spatial reference, otherwise the
+  // spatialReferenceChanged handler will
+  if (m_mapView->spatialReference().isValid())
+    zoomToGraphics();
 }
 
 void GODictionaryRenderer::zoomToGraphics()
 {
-  if (m_graphicsOverlay)
+  if (m_graphicsOverlay && !m_graphicsOverlay->extent().isEmpty())
     m_mapView->setViewpointGeometry(m_graphicsOverlay->extent(), 20);
 }
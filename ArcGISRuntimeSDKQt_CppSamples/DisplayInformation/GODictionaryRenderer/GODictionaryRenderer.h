@@ -20,9 +20,13 @@
 // C++ API headers
 #include "Envelope.h"
 
+// Sample headers
+#include "MilMessageReader.h"
+
 // Qt headers
+#include <QElapsedTimer>
+#include <QHash>
 #include <QQuickItem>
-#include <QXmlStreamReader>
 
 namespace Esri
 {
@@ -31,14 +35,21 @@ namespace Esri
     class Map;
     class GraphicsOverlay;
     class MapQuickView;
+    class MultipointBuilder;
+    class PointCollection;
   }
 }
 
+class QThread;
+
 class GODictionaryRenderer : public QQuickItem
 {
   Q_OBJECT
 
   Q_PROPERTY(bool graphicsLoaded READ graphicsLoaded NOTIFY graphicsLoadedChanged)
+  Q_PROPERTY(double loadProgress READ loadProgress NOTIFY loadProgressChanged)
+  Q_PROPERTY(int messageCount READ messageCount NOTIFY messageCountChanged)
+  Q_PROPERTY(double messagesPerSecond READ messagesPerSecond NOTIFY messageCountChanged)
 
 public:
   explicit GODictionaryRenderer(QQuickItem* parent = nullptr);
@@ -49,19 +60,36 @@ public:
 
 signals:
   void graphicsLoadedChanged();
+  void loadProgressChanged();
+  void messageCountChanged();
 
 private:
-  static const QString FIELD_CONTROL_POINTS;
-  static const QString FIELD_WKID;
+  // a reusable builder and point collection for one spatial reference
+  struct MultipointParts
+  {
+    Esri::ArcGISRuntime::MultipointBuilder* builder = nullptr;
+    Esri::ArcGISRuntime::PointCollection* points = nullptr;
+  };
 
   bool graphicsLoaded() const;
+  double loadProgress() const;
+  int messageCount() const;
+  double messagesPerSecond() const;
   void parseXmlFile();
-  void createGraphic(QVariantMap rawAttributes);
+  void appendMessages(const MilMessageReader::MessageBatch& batch);
+  Esri::ArcGISRuntime::Geometry createGeometry(const MilMessageReader::Message& message);
+  void loadingFinished();
   void zoomToGraphics();
 
   bool m_graphicsLoaded = false;
+  double m_loadProgress = 0.0;
+  int m_messageCount = 0;
+  double m_messagesPerSecond = 0.0;
+  QElapsedTimer m_loadClock;
   QString m_dataPath;
-  QXmlStreamReader m_xmlParser;
+  QThread* m_readerThread = nullptr;
+  MilMessageReader* m_reader = nullptr;
+  QHash<int, MultipointParts> m_multipointParts;
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   Esri::ArcGISRuntime::GraphicsOverlay* m_graphicsOverlay = nullptr;
@@ -33,11 +33,13 @@ TARGET = GODictionaryRenderer
 #-------------------------------------------------------------------------------
 
 HEADERS += \
-    GODictionaryRenderer.h
+    GODictionaryRenderer.h \
+    MilMessageReader.h
 
 SOURCES += \
     main.cpp \
-    GODictionaryRenderer.cpp
+    GODictionaryRenderer.cpp \
+    MilMessageReader.cpp
 
 RESOURCES += GODictionaryRenderer.qrc
 
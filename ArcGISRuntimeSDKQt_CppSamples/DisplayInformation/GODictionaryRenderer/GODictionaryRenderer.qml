@@ -29,13 +29,33 @@ GODictionaryRendererSample {
         anchors.fill: parent
     }
 
-    ProgressBar {
+    Column {
         anchors {
             horizontalCenter: parent.horizontalCenter
             bottom: parent.bottom
             margins: 5
         }
-        indeterminate: true
-        visible: graphicsLoaded
+        spacing: 5
+
+        ProgressBar {
+            anchors.horizontalCenter: parent.horizontalCenter
+            value: loadProgress
+            visible: !graphicsLoaded
+        }
+
+        Rectangle {
+            anchors.horizontalCenter: parent.horizontalCenter
+            width: statusText.width + 10
+            height: statusText.height + 10
+            color: "white"
+            opacity: 0.8
+            radius: 5
+
+            Text {
+                id: statusText
+                anchors.centerIn: parent
+                text: "%1 messages (%2 messages/s)".arg(messageCount).arg(messagesPerSecond.toFixed(0))
+            }
+        }
     }
 }
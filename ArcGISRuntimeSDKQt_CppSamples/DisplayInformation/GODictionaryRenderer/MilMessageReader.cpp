@@ -0,0 +1,195 @@
+// [WriteFile Name=GODictionaryRenderer, Category=DisplayInformation]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "MilMessageReader.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QXmlStreamReader>
+
+namespace
+{
+const QString FIELD_CONTROL_POINTS = QStringLiteral("_control_points");
+const QString FIELD_WKID = QStringLiteral("_wkid");
+const QString ELEMENT_MESSAGE = QStringLiteral("message");
+} // namespace
+
+MilMessageReader::MilMessageReader(QObject* parent) :
+  QObject(parent)
+{
+  qRegisterMetaType<MilMessageReader::MessageBatch>();
+}
+
+MilMessageReader::~MilMessageReader() = default;
+
+void MilMessageReader::batchConsumed()
+{
+  m_batchSlots.release();
+}
+
+void MilMessageReader::cancel()
+{
+  m_cancelled = true;
+
+  // wake the parser if it is waiting for the receiver to catch up
+  m_batchSlots.release(maxBatchesInFlight);
+}
+
+void MilMessageReader::readFile(const QString& filePath, int batchSize)
+{
+  QElapsedTimer clock;
+  clock.start();
+
+  QFile xmlFile(filePath);
+  if (!xmlFile.open(QIODevice::ReadOnly | QIODevice::Text))
+  {
+    emit errorOccurred(QString("Could not open %1: %2").arg(filePath, xmlFile.errorString()));
+    return;
+  }
+
+  const qint64 fileSize = qMax<qint64>(xmlFile.size(), 1);
+  QXmlStreamReader xmlParser(&xmlFile);
+
+  MessageBatch batch;
+  batch.reserve(batchSize);
+  QVariantMap elementValues;
+  QString currentElementName;
+  bool readingMessage = false;
+  qint64 messageCount = 0;
+  qint64 skippedCount = 0;
+  int lastPercent = -1;
+
+  while (!xmlParser.atEnd() && !m_cancelled)
+  {
+    xmlParser.readNext();
+
+    if (xmlParser.isStartElement())
+    {
+      if (xmlParser.name() == ELEMENT_MESSAGE)
+      {
+        // This is the start of a message element.
+        readingMessage = true;
+        elementValues.clear();
+        currentElementName.clear();
+      }
+      else if (readingMessage)
+      {
+        // Remember which element we're reading
+        currentElementName = xmlParser.name().toString();
+      }
+    }
+    else if (xmlParser.isEndElement())
+    {
+      if (xmlParser.name() == ELEMENT_MESSAGE && readingMessage)
+      {
+        // A complete message that defines a military feature to display on the map.
+        readingMessage = false;
+        Message message;
+        if (parseMessage(elementValues, message))
+        {
+          batch.append(std::move(message));
+          ++messageCount;
+        }
+        else
+        {
+          ++skippedCount;
+        }
+
+        if (batch.size() >= batchSize && !deliver(batch))
+          break;
+      }
+      else
+      {
+        currentElementName.clear();
+      }
+    }
+    else if (readingMessage && xmlParser.isCharacters() && !currentElementName.isEmpty())
+    {
+      // Get the text and store it as the current element's value
+      const QStringRef trimmedText = xmlParser.text().trimmed();
+      if (!trimmedText.isEmpty())
+        elementValues[currentElementName] = trimmedText.toString();
+    }
+
+    const int percent = static_cast<int>(100 * xmlFile.pos() / fileSize);
+    if (percent != lastPercent)
+    {
+      lastPercent = percent;
+      emit progressChanged(percent / 100.0);
+    }
+  }
+
+  if (xmlParser.hasError())
+    emit errorOccurred(xmlParser.errorString());
+
+  if (!batch.isEmpty())
+    deliver(batch);
+
+  emit finished(messageCount, skippedCount, clock.elapsed());
+}
+
+// Splits the control points and spatial reference out of the raw attributes;
+// they are not needed in the graphic's attributes.
+bool MilMessageReader::parseMessage(QVariantMap& attributes, Message& message)
+{
+  // If _wkid was absent, use WGS 1984 (4326) by default.
+  bool ok = false;
+  const int wkid = attributes.take(FIELD_WKID).toInt(&ok);
+  if (ok)
+    message.wkid = wkid;
+
+  const QString controlPoints = attributes.take(FIELD_CONTROL_POINTS).toString();
+  const QVector<QStringRef> pointStrings = controlPoints.splitRef(';', Qt::SkipEmptyParts);
+  message.points.reserve(pointStrings.size());
+  for (const QStringRef& pointString : pointStrings)
+  {
+    const QVector<QStringRef> coords = pointString.split(',');
+    if (coords.size() < 2)
+      continue;
+
+    bool xOk = false;
+    bool yOk = false;
+    const double x = coords[0].toDouble(&xOk);
+    const double y = coords[1].toDouble(&yOk);
+    if (xOk && yOk)
+      message.points.append(QPointF(x, y));
+  }
+
+  if (message.points.isEmpty())
+    return false;
+
+  message.attributes = std::move(attributes);
+  return true;
+}
+
+// Hands a full batch to the receiver, waiting while too many are still queued.
+bool MilMessageReader::deliver(MessageBatch& batch)
+{
+  m_batchSlots.acquire();
+  if (m_cancelled)
+    return false;
+
+  const int batchSize = batch.capacity();
+  emit batchReady(batch);
+  batch.clear();
+  batch.reserve(batchSize);
+  return true;
+}
@@ -0,0 +1,73 @@
+// [WriteFile Name=GODictionaryRenderer, Category=DisplayInformation]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+
+#ifndef MILMESSAGEREADER_H
+#define MILMESSAGEREADER_H
+
+#include <QObject>
+#include <QPointF>
+#include <QSemaphore>
+#include <QVariantMap>
+#include <QVector>
+
+#include <atomic>
+
+// Parses a MIL-STD-2525 message file into plain data on a worker thread.
+// Messages are delivered in batches through the batchReady signal; at most
+// a few batches are in flight at once, and the receiver must call
+// batchConsumed() after handling each one so the parser can continue.
+class MilMessageReader : public QObject
+{
+  Q_OBJECT
+
+public:
+  struct Message
+  {
+    QVariantMap attributes;
+    int wkid = 4326;
+    QVector<QPointF> points;
+  };
+  using MessageBatch = QVector<Message>;
+
+  explicit MilMessageReader(QObject* parent = nullptr);
+  ~MilMessageReader() override;
+
+  // thread safe, may be called from any thread
+  void batchConsumed();
+  void cancel();
+
+public slots:
+  void readFile(const QString& filePath, int batchSize);
+
+signals:
+  void batchReady(const MilMessageReader::MessageBatch& batch);
+  void progressChanged(double progress);
+  void finished(qint64 messageCount, qint64 skippedCount, qint64 elapsedMs);
+  void errorOccurred(const QString& message);
+
+private:
+  static bool parseMessage(QVariantMap& attributes, Message& message);
+  bool deliver(MessageBatch& batch);
+
+  static constexpr int maxBatchesInFlight = 4;
+  QSemaphore m_batchSlots{maxBatchesInFlight};
+  std::atomic_bool m_cancelled{false};
+};
+
+Q_DECLARE_METATYPE(MilMessageReader::MessageBatch)
+
+#endif // MILMESSAGEREADER_H
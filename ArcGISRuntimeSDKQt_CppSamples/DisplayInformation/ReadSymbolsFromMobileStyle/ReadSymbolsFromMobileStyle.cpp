@@ -191,6 +191,11 @@ void ReadSymbolsFromMobileStyle::setMapView(MapQuickView* mapView)
   engine->addImageProvider(SymbolImageProvider::imageProviderId(), new SymbolImageProvider);
   m_symbolImageProvider = static_cast<SymbolImageProvider*>(engine->imageProvider(SymbolImageProvider::imageProviderId()));
 
+  // swatches evicted from the provider's memory budget are kept on disk, and
+  // the statistics are refreshed whenever the cache reports a change
+  m_symbolImageProvider->cache().enableSpilling("ReadSymbolsFromMobileStyle");
+  connect(&m_symbolImageProvider->cache(), &ImageCache::statisticsChanged, this, &ReadSymbolsFromMobileStyle::updateImageCacheStatistics);
+
   // add a graphics overlay
   GraphicsOverlay* overlay = new GraphicsOverlay(this);
   m_mapView->graphicsOverlays()->append(overlay);
@@ -263,3 +268,21 @@ SymbolStyleSearchResultListModel* ReadSymbolsFromMobileStyle::faceResults() cons
 {
   return m_models[3];
 }
+
+QString ReadSymbolsFromMobileStyle::imageCacheStatistics() const
+{
+  return m_imageCacheStatistics;
+}
+
+void ReadSymbolsFromMobileStyle::updateImageCacheStatistics()
+{
+  if (!m_symbolImageProvider)
+    return;
+
+  const QString statistics = m_symbolImageProvider->cache().statistics().toString();
+  if (statistics == m_imageCacheStatistics)
+    return;
+
+  m_imageCacheStatistics = statistics;
+  emit imageCacheStatisticsChanged();
+}
@@ -48,6 +48,7 @@ class ReadSymbolsFromMobileStyle : public QObject
   Q_PROPERTY(Esri::ArcGISRuntime::SymbolStyleSearchResultListModel* mouthResults READ mouthResults NOTIFY symbolResultsChanged)
   Q_PROPERTY(Esri::ArcGISRuntime::SymbolStyleSearchResultListModel* eyesResults READ eyeResults NOTIFY symbolResultsChanged)
   Q_PROPERTY(QUrl symbolImageUrl MEMBER m_symbolImageUrl NOTIFY symbolImageUrlChanged)
+  Q_PROPERTY(QString imageCacheStatistics READ imageCacheStatistics NOTIFY imageCacheStatisticsChanged)
 
 public:
   explicit ReadSymbolsFromMobileStyle(QObject* parent = nullptr);
@@ -62,6 +63,7 @@ signals:
   void mapViewChanged();
   void symbolResultsChanged();
   void symbolImageUrlChanged();
+  void imageCacheStatisticsChanged();
 
 private:
   Esri::ArcGISRuntime::MapQuickView* mapView() const;
@@ -71,12 +73,15 @@ private:
   Esri::ArcGISRuntime::SymbolStyleSearchResultListModel* mouthResults() const;
   Esri::ArcGISRuntime::SymbolStyleSearchResultListModel* eyeResults() const;
   Esri::ArcGISRuntime::SymbolStyleSearchResultListModel* faceResults() const;
+  QString imageCacheStatistics() const;
+  void updateImageCacheStatistics();
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   Esri::ArcGISRuntime::MultilayerPointSymbol* m_currentSymbol = nullptr;
   Esri::ArcGISRuntime::SymbolStyle* m_symbolStyle = nullptr;
   SymbolImageProvider* m_symbolImageProvider = nullptr;
+  QString m_imageCacheStatistics;
   QList<Esri::ArcGISRuntime::SymbolStyleSearchResultListModel*> m_models = { nullptr, nullptr, nullptr, nullptr };
   QList<QUuid> m_taskIds;
   QColor m_currentColor = QColor(Qt::yellow);
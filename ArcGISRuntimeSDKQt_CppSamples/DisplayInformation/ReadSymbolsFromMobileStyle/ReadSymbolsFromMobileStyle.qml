@@ -134,6 +134,11 @@ Item {
             width: 40
             height: 40
         }
+
+        Label {
+            Layout.columnSpan: 2
+            text: "Swatch cache: " + model.imageCacheStatistics
+        }
     }
 
     function updateSymbol() {
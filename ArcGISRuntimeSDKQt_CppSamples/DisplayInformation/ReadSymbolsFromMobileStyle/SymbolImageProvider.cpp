@@ -23,15 +23,20 @@ SymbolImageProvider::SymbolImageProvider() :
 // reimplemented function for QML to request Images from the provider
 QImage SymbolImageProvider::requestImage(const QString& id, QSize* size, const QSize& requestedSize)
 {  
-  Q_UNUSED(size)
-  Q_UNUSED(requestedSize)
-  return m_images[id];
+  // images are served from a bounded LRU cache, scaled down to the requested size
+  return m_images.image(id, size, requestedSize);
 }
 
 // helper to add images to the the provider
 void SymbolImageProvider::addImage(const QString& id, const QImage& img)
 {
-  m_images[id] = img;
+  m_images.insert(id, img);
+}
+
+// the cache holding the images, e.g. to configure its budget or read its statistics
+ImageCache& SymbolImageProvider::cache()
+{
+  return m_images;
 }
 
 // static function to return the image provider id
@@ -34,6 +34,9 @@
 #include "QueryParameters.h"
 #include "FeatureQueryResult.h"
 #include "Feature.h"
+#include "AttributeListModel.h"
+#include "Field.h"
+#include "OrderBy.h"
 #include <QUrl>
 #include <QColor>
 #include <QList>
@@ -41,6 +44,12 @@
 
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+    // number of features requested and held in memory at a time
+    constexpr int pageSize = 250;
+}
+
 FeatureLayerQuery::FeatureLayerQuery(QQuickItem* parent) :
     QQuickItem(parent)
 {
@@ -93,42 +102,75 @@ void FeatureLayerQuery::componentComplete()
 
 void FeatureLayerQuery::connectSignals()
 {
-    // iterate over the query results once the query is done
-    connect(m_featureTable, &ServiceFeatureTable::queryFeaturesCompleted, this, [this](QUuid, FeatureQueryResult* rawQueryResult)
+    // process each page of results as it arrives
+    connect(m_featureTable, &ServiceFeatureTable::queryFeaturesCompleted, this, [this](QUuid taskId, FeatureQueryResult* rawQueryResult)
     {
-      auto queryResult = std::unique_ptr<FeatureQueryResult>(rawQueryResult);
+        auto queryResult = std::unique_ptr<FeatureQueryResult>(rawQueryResult);
 
-        if (queryResult && !queryResult->iterator().hasNext())
+        // ignore pages of a query that has been superseded
+        if (taskId != m_pageTaskId)
+            return;
+
+        m_pageTaskId = QUuid();
+        if (!queryResult)
         {
-            m_queryResultsCount = 0;
-            emit queryResultsCountChanged();
+            failQuery("The query did not return a result.");
             return;
         }
 
-        // clear any existing selection
-        m_featureLayer->clearSelection();
-        QList<Feature*> features;
+        processPage(queryResult.get());
+    });
 
-        // iterate over the result object
-        while(queryResult->iterator().hasNext())
-        {
-            Feature* feature = queryResult->iterator().next(this);
-            // add each feature to the list
-            features.append(feature);
-        }
+    // the errors do not name their task; they fail the query while one of its
+    // pages or selections is still in flight
+    connect(m_featureTable, &ServiceFeatureTable::errorOccurred, this, [this](Error error)
+    {
+        if (m_pageTaskId.isNull() && m_selectionTasks.isEmpty())
+            return;
 
-        // select the feature
-        m_featureLayer->selectFeatures(features);
-        // zoom to the first feature
-        m_mapView->setViewpointGeometry(features.at(0)->geometry(), 30);
-        // set the count for QML property
-        m_queryResultsCount = features.count();
-        emit queryResultsCountChanged();
+        failQuery(error.message());
+    });
+
+    connect(m_featureLayer, &FeatureLayer::errorOccurred, this, [this](Error error)
+    {
+        if (m_pageTaskId.isNull() && m_selectionTasks.isEmpty())
+            return;
+
+        failQuery(error.message());
+    });
+
+    // record when the first batch of a query is selected on the map
+    connect(m_featureLayer, &FeatureLayer::selectFeaturesCompleted, this, [this](QUuid taskId, FeatureQueryResult* rawSelectionResult)
+    {
+        // the selected features are not needed here
+        auto selectionResult = std::unique_ptr<FeatureQueryResult>(rawSelectionResult);
+
+        m_selectionTasks.remove(taskId);
+        if (taskId != m_firstSelectionTaskId)
+            return;
+
+        m_firstSelectionTaskId = QUuid();
+        m_timeToFirstSelection = static_cast<int>(m_queryTimer.elapsed());
+        emit queryStatisticsChanged();
     });
 
     connect(m_featureTable, &ServiceFeatureTable::loadStatusChanged, this, [this](LoadStatus loadStatus)
     {
         loadStatus == LoadStatus::Loaded ? m_initialized = true : m_initialized = false;
+
+        // remember the object ID field, the selection is made by object IDs
+        if (m_initialized)
+        {
+            for (const Field& field : m_featureTable->fields())
+            {
+                if (field.fieldType() == FieldType::OID)
+                {
+                    m_objectIdField = field.name();
+                    break;
+                }
+            }
+        }
+
         emit layerInitializedChanged();
     });
 }
@@ -140,10 +182,124 @@ bool FeatureLayerQuery::layerInitialized() const
 
 void FeatureLayerQuery::runQuery(const QString& stateName)
 {
-    // create a query parameter object and set the where clause
+    // stop adding batches of the previous query, clear any existing selection and start over
+    cancelSelection();
+    m_whereClause = QString("STATE_NAME LIKE '" + formatStateNameForQuery(stateName) + "%'");
+    m_pageOffset = 0;
+    m_queryResultsCount = 0;
+    m_peakFeaturesHeld = m_featuresHeld;
+    m_queryError.clear();
+    m_timeToFirstSelection = -1;
+    emit queryStatisticsChanged();
+
+    m_queryTimer.start();
+    queryNextPage();
+}
+
+void FeatureLayerQuery::queryNextPage()
+{
+    // create a query parameter object for the next page; paging needs a stable order
     QueryParameters queryParams;
-    queryParams.setWhereClause(QString("STATE_NAME LIKE '" + formatStateNameForQuery(stateName) + "%'"));
-    m_featureTable->queryFeatures(queryParams);
+    queryParams.setWhereClause(m_whereClause);
+    queryParams.setResultOffset(m_pageOffset);
+    queryParams.setMaxFeatures(pageSize);
+    queryParams.setOrderByFields(QList<OrderBy>{OrderBy(m_objectIdField, SortOrder::Ascending)});
+
+    m_pageTaskId = m_featureTable->queryFeatures(queryParams, QueryFeatureFields::MinimumFields).taskId();
+}
+
+// Collects the object IDs of a page, releasing each feature as it goes, and
+// selects them as one batch.
+void FeatureLayerQuery::processPage(FeatureQueryResult* queryResult)
+{
+    QList<qint64> objectIds;
+    objectIds.reserve(pageSize);
+
+    while (queryResult->iterator().hasNext())
+    {
+        std::unique_ptr<Feature> feature(queryResult->iterator().next());
+        trackFeature(feature.get());
+
+        // zoom to the first feature
+        if (m_pageOffset == 0 && objectIds.isEmpty())
+            m_mapView->setViewpointGeometry(feature->geometry(), 30);
+
+        bool ok = false;
+        const qint64 objectId = feature->attributes()->attributeValue(m_objectIdField).toLongLong(&ok);
+        if (!ok)
+        {
+            failQuery(QString("A feature has no valid %1 value.").arg(m_objectIdField));
+            return;
+        }
+
+        objectIds.append(objectId);
+    }
+
+    if (!objectIds.isEmpty())
+    {
+        // select the batch by object ID
+        QueryParameters selectionParams;
+        selectionParams.setObjectIds(objectIds);
+        const TaskWatcher selectionTask = m_featureLayer->selectFeatures(selectionParams, SelectionMode::Add);
+        const QUuid selectionTaskId = selectionTask.taskId();
+        m_selectionTasks.insert(selectionTaskId, selectionTask);
+        if (m_pageOffset == 0)
+            m_firstSelectionTaskId = selectionTaskId;
+
+        // set the count for QML property
+        m_queryResultsCount += objectIds.count();
+        emit queryResultsCountChanged();
+    }
+
+    // a full page, or a page cut short by the service's record limit, means there may be more
+    m_pageOffset += objectIds.count();
+    if (!objectIds.isEmpty() && (objectIds.count() == pageSize || queryResult->isTransferLimitExceeded()))
+    {
+        queryNextPage();
+        return;
+    }
+
+    finishQuery();
+}
+
+// Counts a feature object until it is destroyed, recording the most held at once.
+void FeatureLayerQuery::trackFeature(Feature* feature)
+{
+    ++m_featuresHeld;
+    m_peakFeaturesHeld = qMax(m_peakFeaturesHeld, m_featuresHeld);
+    connect(feature, &QObject::destroyed, this, [this]()
+    {
+        --m_featuresHeld;
+    });
+}
+
+// Stops selecting the remaining batches and clears the batches selected so far.
+void FeatureLayerQuery::cancelSelection()
+{
+    for (TaskWatcher& selectionTask : m_selectionTasks)
+        selectionTask.cancel();
+    m_selectionTasks.clear();
+    m_firstSelectionTaskId = QUuid();
+    m_featureLayer->clearSelection();
+}
+
+void FeatureLayerQuery::failQuery(const QString& message)
+{
+    // no further pages are requested and the partial selection is removed
+    m_pageTaskId = QUuid();
+    cancelSelection();
+    m_queryError = message;
+    m_queryResultsCount = 0;
+    finishQuery();
+}
+
+void FeatureLayerQuery::finishQuery()
+{
+    // an empty result still needs to be reported to show the error message
+    if (m_queryResultsCount == 0)
+        emit queryResultsCountChanged();
+
+    emit queryStatisticsChanged();
 }
 
 QString FeatureLayerQuery::formatStateNameForQuery(const QString& stateName) const
@@ -169,3 +325,18 @@ int FeatureLayerQuery::queryResultsCount() const
 {
     return m_queryResultsCount;
 }
+
+int FeatureLayerQuery::peakFeaturesHeld() const
+{
+    return m_peakFeaturesHeld;
+}
+
+QString FeatureLayerQuery::queryError() const
+{
+    return m_queryError;
+}
+
+int FeatureLayerQuery::timeToFirstSelection() const
+{
+    return m_timeToFirstSelection;
+}
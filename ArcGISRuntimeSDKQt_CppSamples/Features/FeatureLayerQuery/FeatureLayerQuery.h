@@ -23,12 +23,19 @@ namespace Esri
   {
     class Map;
     class MapQuickView;
+    class Feature;
     class FeatureLayer;
+    class FeatureQueryResult;
     class ServiceFeatureTable;
   }
 }
 
+#include "TaskWatcher.h"
+
+#include <QElapsedTimer>
+#include <QHash>
 #include <QQuickItem>
+#include <QUuid>
 
 class FeatureLayerQuery : public QQuickItem
 {
@@ -36,6 +43,9 @@ class FeatureLayerQuery : public QQuickItem
 
   Q_PROPERTY(bool layerInitialized READ layerInitialized NOTIFY layerInitializedChanged)
   Q_PROPERTY(int queryResultsCount READ queryResultsCount NOTIFY queryResultsCountChanged)
+  Q_PROPERTY(int peakFeaturesHeld READ peakFeaturesHeld NOTIFY queryStatisticsChanged)
+  Q_PROPERTY(QString queryError READ queryError NOTIFY queryStatisticsChanged)
+  Q_PROPERTY(int timeToFirstSelection READ timeToFirstSelection NOTIFY queryStatisticsChanged)
 
 public:
   explicit FeatureLayerQuery(QQuickItem* parent = nullptr);
@@ -48,14 +58,24 @@ public:
 signals:
   void layerInitializedChanged();
   void queryResultsCountChanged();
+  void queryStatisticsChanged();
 
 private:
   void connectSignals();
   bool layerInitialized() const;
   int queryResultsCount() const;
+  int peakFeaturesHeld() const;
+  QString queryError() const;
+  int timeToFirstSelection() const;
 
 private:
   QString formatStateNameForQuery(const QString& stateName) const;
+  void queryNextPage();
+  void processPage(Esri::ArcGISRuntime::FeatureQueryResult* queryResult);
+  void trackFeature(Esri::ArcGISRuntime::Feature* feature);
+  void cancelSelection();
+  void failQuery(const QString& message);
+  void finishQuery();
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
@@ -63,6 +83,20 @@ private:
   Esri::ArcGISRuntime::ServiceFeatureTable* m_featureTable = nullptr;
   bool m_initialized = false;
   int m_queryResultsCount = 0;
+
+  // state of the paged query that is in progress
+  QString m_whereClause;
+  QString m_objectIdField;
+  QUuid m_pageTaskId;
+  QUuid m_firstSelectionTaskId;
+  QHash<QUuid, Esri::ArcGISRuntime::TaskWatcher> m_selectionTasks;
+  int m_pageOffset = 0;
+  QElapsedTimer m_queryTimer;
+  // feature objects from query results which are alive, and the most at once
+  int m_featuresHeld = 0;
+  int m_peakFeaturesHeld = 0;
+  QString m_queryError;
+  int m_timeToFirstSelection = -1;
 };
 
 #endif // FEATURE_LAYER_QUERY_H
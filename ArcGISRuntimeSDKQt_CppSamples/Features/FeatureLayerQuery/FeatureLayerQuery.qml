@@ -66,6 +66,29 @@ FeatureLayerQuerySample {
         }
     }
 
+    Rectangle {
+        anchors {
+            left: parent.left
+            bottom: parent.bottom
+            margins: 5
+            bottomMargin: 30
+        }
+        width: statisticsText.width + 10
+        height: statisticsText.height + 10
+        color: "white"
+        opacity: 0.8
+        radius: 5
+        visible: featureLayerQuerySample.queryResultsCount > 0
+
+        Text {
+            id: statisticsText
+            anchors.centerIn: parent
+            text: "Peak features held at once: %1\nFirst selection after: %2 ms"
+                  .arg(featureLayerQuerySample.peakFeaturesHeld)
+                  .arg(featureLayerQuerySample.timeToFirstSelection)
+        }
+    }
+
     Dialog {
         id: errorMsgDialog
         modal: true
@@ -81,7 +104,11 @@ FeatureLayerQuerySample {
 
     onQueryResultsCountChanged: {
         // Use the C++ property to determine if no features were returned
-        if (featureLayerQuerySample.queryResultsCount === 0)
+        if (featureLayerQuerySample.queryResultsCount === 0) {
+            errorMsgDialog.text = featureLayerQuerySample.queryError !== "" ?
+                        featureLayerQuerySample.queryError :
+                        "No state named " + findText.text.toUpperCase() + " exists.";
             errorMsgDialog.visible = true;
+        }
     }
 }
@@ -35,9 +35,12 @@
 #include "RelatedFeature.h"
 #include "RelatedFeatureListModel.h"
 
+#include <QElapsedTimer>
 #include <QList>
 #include <QUrl>
+#include <QVector>
 #include <memory>
+#include <utility>
 
 using namespace Esri::ArcGISRuntime;
 
@@ -112,6 +115,11 @@ void ListRelatedFeatures::connectSignals()
                 this, [this](QUuid, QList<RelatedFeatureQueryResult*> rawRelatedResults)
         {
           FeatureQueryListResultLock lock(rawRelatedResults);
+          QElapsedTimer timer;
+          timer.start();
+
+          // collect the related features so the model is populated in one transaction
+          QVector<RelatedFeature> relatedFeatures;
           for (const RelatedFeatureQueryResult* relatedResult : lock.results)
           {
             while (relatedResult->iterator().hasNext())
@@ -123,15 +131,21 @@ void ListRelatedFeatures::connectSignals()
               const QString serviceLayerName = relatedTable->layerInfo().serviceLayerName();
               const QString displayFieldValue = feature->attributes()->attributeValue(displayFieldName).toString();
 
-              // add the related feature to the list model
-              RelatedFeature relatedFeature = RelatedFeature(displayFieldName,
-                                                             displayFieldValue,
-                                                             serviceLayerName);
-              m_relatedFeaturesModel->addRelatedFeature(relatedFeature);
-              emit relatedFeaturesModelChanged();
+              // add the related feature to the list
+              relatedFeatures.append(RelatedFeature(displayFieldName,
+                                                    displayFieldValue,
+                                                    serviceLayerName));
             }
           }
 
+          // add the related features to the list model
+          m_populatedCount = relatedFeatures.count();
+          m_relatedFeaturesModel->appendRelatedFeatures(std::move(relatedFeatures));
+          emit relatedFeaturesModelChanged();
+
+          m_populationTime = timer.nsecsElapsed() / 1.0e6;
+          emit populationStatisticsChanged();
+
           if (m_selectedFeature)
           {
             delete m_selectedFeature;
@@ -37,6 +37,8 @@ class ListRelatedFeatures : public QQuickItem
   Q_OBJECT
 
   Q_PROPERTY(RelatedFeatureListModel* relatedFeaturesModel MEMBER m_relatedFeaturesModel NOTIFY relatedFeaturesModelChanged)
+  Q_PROPERTY(int populatedCount MEMBER m_populatedCount NOTIFY populationStatisticsChanged)
+  Q_PROPERTY(double populationTime MEMBER m_populationTime NOTIFY populationStatisticsChanged)
 
 public:
   explicit ListRelatedFeatures(QQuickItem* parent = nullptr);
@@ -49,6 +51,7 @@ signals:
   void showAttributeTable();
   void hideAttributeTable();
   void relatedFeaturesModelChanged();
+  void populationStatisticsChanged();
 
 private:
   void connectSignals();
@@ -60,6 +63,9 @@ private:
   Esri::ArcGISRuntime::ArcGISFeatureTable* m_alaskaFeatureTable = nullptr;
   Esri::ArcGISRuntime::ArcGISFeature* m_selectedFeature = nullptr;
   RelatedFeatureListModel* m_relatedFeaturesModel = nullptr;
+  // number of related features and milliseconds taken to add them from the last query
+  int m_populatedCount = 0;
+  double m_populationTime = 0.0;
 };
 
 #endif // LISTRELATEDFEATURES_H
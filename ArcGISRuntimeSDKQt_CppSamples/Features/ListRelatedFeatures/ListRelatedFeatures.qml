@@ -53,6 +53,20 @@ ListRelatedFeaturesSample {
             }
         }
 
+        // time taken to populate the model from the related features query
+        Text {
+            id: populationText
+            anchors {
+                right: parent.right
+                top: parent.top
+                margins: 5
+            }
+            text: "Populated %1 features in %2 ms".arg(populatedCount).arg(populationTime.toFixed(1))
+            font.pixelSize: 10
+            color: "gray"
+            visible: parent.height > 0
+        }
+
         ListView {
             anchors {
                 fill: parent
@@ -24,14 +24,15 @@ class RelatedFeature
 {
 
 public:
+  RelatedFeature() = default;
   explicit RelatedFeature(const QString& displayFieldName, const QString& displayFieldValue,
                           const QString& serviceLayerName);
   ~RelatedFeature() = default;
 
 public:
-  QString displayFieldName() const { return m_displayFieldName; }
-  QString displayFieldValue() const { return m_displayFieldValue; }
-  QString serviceLayerName() const { return m_serviceLayerName; }
+  const QString& displayFieldName() const { return m_displayFieldName; }
+  const QString& displayFieldValue() const { return m_displayFieldValue; }
+  const QString& serviceLayerName() const { return m_serviceLayerName; }
 
 private:
   QString m_displayFieldName;
@@ -25,6 +25,8 @@
 #include <QObject>
 #include <QVariant>
 
+#include <utility>
+
 #include "RelatedFeatureListModel.h"
 #include "RelatedFeature.h"
 
@@ -36,9 +38,36 @@ RelatedFeatureListModel::RelatedFeatureListModel(QObject* parent) :
 void RelatedFeatureListModel::addRelatedFeature(RelatedFeature relatedFeature)
 {
   beginInsertRows(QModelIndex(), rowCount(), rowCount());
-  m_relatedFeatures << relatedFeature;
+  m_relatedFeatures.append(std::move(relatedFeature));
+  endInsertRows();
+}
+
+void RelatedFeatureListModel::appendRelatedFeatures(QVector<RelatedFeature> relatedFeatures)
+{
+  if (relatedFeatures.isEmpty())
+    return;
+
+  if (m_relatedFeatures.isEmpty())
+  {
+    setRelatedFeatures(std::move(relatedFeatures));
+    return;
+  }
+
+  const int first = rowCount();
+  beginInsertRows(QModelIndex(), first, first + relatedFeatures.count() - 1);
+  m_relatedFeatures.reserve(first + relatedFeatures.count());
+  for (RelatedFeature& relatedFeature : relatedFeatures)
+    m_relatedFeatures.append(std::move(relatedFeature));
   endInsertRows();
 }
+
+void RelatedFeatureListModel::setRelatedFeatures(QVector<RelatedFeature> relatedFeatures)
+{
+  beginResetModel();
+  m_relatedFeatures = std::move(relatedFeatures);
+  endResetModel();
+}
+
 int RelatedFeatureListModel::rowCount(const QModelIndex& parent) const
 {
   Q_UNUSED(parent);
@@ -50,7 +79,7 @@ QVariant RelatedFeatureListModel::data(const QModelIndex& index, int role) const
   if (index.row() < 0 || index.row() >= m_relatedFeatures.count())
     return QVariant();
 
-  RelatedFeature relatedFeature = m_relatedFeatures[index.row()];
+  const RelatedFeature& relatedFeature = m_relatedFeatures.at(index.row());
 
   if (role == DisplayFieldNameRole)
     return relatedFeature.displayFieldName();
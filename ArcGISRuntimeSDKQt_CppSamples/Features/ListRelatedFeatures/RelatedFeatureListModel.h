@@ -20,7 +20,7 @@
 #include <QAbstractListModel>
 #include <QByteArray>
 #include <QHash>
-#include <QList>
+#include <QVector>
 #include <RelatedFeature.h>
 
 class RelatedFeatureListModel : public QAbstractListModel
@@ -39,6 +39,10 @@ public:
   ~RelatedFeatureListModel() override = default;
 
   void addRelatedFeature(RelatedFeature relatedFeature);
+  // inserts a whole result set in a single model transaction
+  void appendRelatedFeatures(QVector<RelatedFeature> relatedFeatures);
+  // replaces the current features with a single model reset
+  void setRelatedFeatures(QVector<RelatedFeature> relatedFeatures);
   int rowCount(const QModelIndex& parent = QModelIndex()) const override;
   QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
   void clear();
@@ -48,7 +52,7 @@ protected:
   QHash<int, QByteArray> roleNames() const override;
 
 private:
-  QList<RelatedFeature> m_relatedFeatures;
+  QVector<RelatedFeature> m_relatedFeatures;
 };
 
 #endif // RELATEDFEATURELISTMODEL_H
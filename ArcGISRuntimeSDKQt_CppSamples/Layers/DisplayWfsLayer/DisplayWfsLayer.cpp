@@ -24,19 +24,50 @@
 #include "MapQuickView.h"
 #include "WfsFeatureTable.h"
 #include "FeatureLayer.h"
+#include "FeatureQueryResult.h"
+#include "GeometryEngine.h"
 #include "QueryParameters.h"
 #include "SimpleRenderer.h"
 #include "SimpleLineSymbol.h"
 
+#include <QtMath>
+#include <climits>
+#include <algorithm>
+#include <memory>
+
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+// width and height of the cells the visible area is requested in, in meters
+constexpr double cellSize = 250.0;
+// views covering more cells are requested as one whole-extent request
+constexpr qint64 maxCellsPerView = 256;
+constexpr int maxRequestsInFlight = 4;
+// once the table holds more features, it is cleared and refilled for the current view
+constexpr quint64 featureBudget = 20000;
+
+// Set DISPLAYWFSLAYER_SERVICE_URL to use another WFS server with the same
+// table, such as a local stand-in server.
+QUrl serviceUrl()
+{
+  const QString url = qEnvironmentVariable("DISPLAYWFSLAYER_SERVICE_URL");
+  if (!url.isEmpty())
+    return QUrl(url);
+
+  return QUrl("https://dservices2.arcgis.com/ZQgQTuoyBrtmoGdP/arcgis/services/Seattle_Downtown_Features/WFSServer?service=wfs&request=getcapabilities");
+}
+
+// stands in for the cell of a whole-extent request
+const QPair<int, int> wholeExtentCell(INT_MIN, INT_MIN);
+} // namespace
+
 DisplayWfsLayer::DisplayWfsLayer(QObject* parent /* = nullptr */):
   QObject(parent),
   m_map(new Map(BasemapStyle::ArcGISTopographic, this))
 {
   // create WFS Feature Table
-  m_wfsFeatureTable = new WfsFeatureTable(QUrl("https://dservices2.arcgis.com/ZQgQTuoyBrtmoGdP/arcgis/services/Seattle_Downtown_Features/WFSServer?service=wfs&request=getcapabilities"),
-                                          "Seattle_Downtown_Features:Buildings", this);
+  m_wfsFeatureTable = new WfsFeatureTable(serviceUrl(), "Seattle_Downtown_Features:Buildings", this);
 
   // Set feature request mode to manual - only manual is supported at v100.5.
   // In this mode, you must manually populate the table - panning and zooming
@@ -50,6 +81,34 @@ DisplayWfsLayer::DisplayWfsLayer(QObject* parent /* = nullptr */):
       populateWfsFeatureTable();
   });
 
+  // a cell is populated once its request completes
+  connect(m_wfsFeatureTable, &WfsFeatureTable::populateFromServiceCompleted, this, [this](QUuid taskId, FeatureQueryResult* rawResult)
+  {
+    // the features are in the table's cache; the result itself is not needed
+    auto result = std::unique_ptr<FeatureQueryResult>(rawResult);
+
+    auto it = m_requestsInFlight.find(taskId);
+    if (it == m_requestsInFlight.end())
+      return;
+
+    if (it.value() != wholeExtentCell)
+      m_populatedCells.insert(it.value());
+    m_requestsInFlight.erase(it);
+
+    if (taskId == m_clearCacheTaskId)
+      m_clearCacheTaskId = QUuid();
+
+    requestCells();
+  });
+
+  // the failed request is not known, so all cells in flight are requested again later
+  connect(m_wfsFeatureTable, &WfsFeatureTable::errorOccurred, this, [this](Error)
+  {
+    m_requestsInFlight.clear();
+    m_clearCacheTaskId = QUuid();
+    requestCells();
+  });
+
   // create feature layer from the feature table
   FeatureLayer* featureLayer = new FeatureLayer(m_wfsFeatureTable, this);
 
@@ -102,18 +161,131 @@ void DisplayWfsLayer::setMapView(MapQuickView* mapView)
   emit mapViewChanged();
 }
 
+// Splits the visible area into grid cells and queues the cells that are not
+// populated yet, in rings outward from the center of the view. A view covering
+// more than maxCellsPerView cells is requested as a whole instead.
 void DisplayWfsLayer::populateWfsFeatureTable()
 {
   if (!m_mapView || !m_wfsFeatureTable)
     return;
 
+  const Envelope extent = GeometryEngine::project(m_mapView->visibleArea().extent(), SpatialReference::webMercator()).extent();
+  if (extent.isEmpty())
+    return;
+
+  // over budget: drop the cached features and populate the current view again
+  if (m_wfsFeatureTable->numberOfFeatures() > featureBudget)
+    m_clearCachePending = true;
+
+  const int minColumn = qFloor(extent.xMin() / cellSize);
+  const int maxColumn = qFloor(extent.xMax() / cellSize);
+  const int minRow = qFloor(extent.yMin() / cellSize);
+  const int maxRow = qFloor(extent.yMax() / cellSize);
+
+  // cells queued for an earlier view are no longer needed
+  m_pendingCells.clear();
+  m_pendingExtent = Envelope();
+
+  if (static_cast<qint64>(maxColumn - minColumn + 1) * (maxRow - minRow + 1) > maxCellsPerView)
+  {
+    m_pendingExtent = extent;
+    requestCells();
+    return;
+  }
+
+  QSet<Cell> cellsInFlight;
+  for (const Cell& cell : qAsConst(m_requestsInFlight))
+    cellsInFlight.insert(cell);
+
+  const int centerColumn = qBound(minColumn, qFloor(extent.center().x() / cellSize), maxColumn);
+  const int centerRow = qBound(minRow, qFloor(extent.center().y() / cellSize), maxRow);
+  const int maxRing = std::max({centerColumn - minColumn, maxColumn - centerColumn,
+                                centerRow - minRow, maxRow - centerRow});
+
+  for (int ring = 0; ring <= maxRing; ++ring)
+  {
+    for (int column = qMax(minColumn, centerColumn - ring); column <= qMin(maxColumn, centerColumn + ring); ++column)
+    {
+      for (int row = qMax(minRow, centerRow - ring); row <= qMin(maxRow, centerRow + ring); ++row)
+      {
+        // only the cells on this ring's border
+        if (qMax(qAbs(column - centerColumn), qAbs(row - centerRow)) != ring)
+          continue;
+
+        const Cell cell(column, row);
+        if (cellsInFlight.contains(cell) || (!m_clearCachePending && m_populatedCells.contains(cell)))
+          continue;
+
+        m_pendingCells.append(cell);
+      }
+    }
+  }
+
+  requestCells();
+}
+
+// Requests queued cells while fewer than maxRequestsInFlight are running.
+// Called again whenever a request completes, until the queue is empty.
+void DisplayWfsLayer::requestCells()
+{
+  // clearing the cache must not race other requests, so it runs on its own
+  bool clearCache = false;
+  if (m_clearCachePending)
+  {
+    if (!m_requestsInFlight.isEmpty() || (m_pendingCells.isEmpty() && m_pendingExtent.isEmpty()))
+    {
+      emit requestStatusChanged();
+      return;
+    }
+
+    m_clearCachePending = false;
+    m_populatedCells.clear();
+    clearCache = true;
+  }
+
+  if (!m_pendingExtent.isEmpty() && m_clearCacheTaskId.isNull() && m_requestsInFlight.size() < maxRequestsInFlight)
+  {
+    startRequest(m_pendingExtent, wholeExtentCell, clearCache);
+    m_pendingExtent = Envelope();
+    clearCache = false;
+  }
+
+  while (m_clearCacheTaskId.isNull() && m_requestsInFlight.size() < maxRequestsInFlight && !m_pendingCells.isEmpty())
+  {
+    const Cell cell = m_pendingCells.takeFirst();
+    startRequest(Envelope(cell.first * cellSize, cell.second * cellSize,
+                          (cell.first + 1) * cellSize, (cell.second + 1) * cellSize,
+                          SpatialReference::webMercator()),
+                 cell, clearCache);
+    clearCache = false;
+  }
+
+  emit requestStatusChanged();
+}
+
+void DisplayWfsLayer::startRequest(const Envelope& area, const Cell& cell, bool clearCache)
+{
   // create query parameters
   QueryParameters params;
-  params.setGeometry(m_mapView->visibleArea().extent());
+  params.setGeometry(area);
   params.setSpatialRelationship(SpatialRelationship::Intersects);
 
   // query the service
-  constexpr bool clearCache = false;
   const QStringList outFields = {"*"};
-  m_wfsFeatureTable->populateFromService(params, clearCache, outFields);
+  const QUuid taskId = m_wfsFeatureTable->populateFromService(params, clearCache, outFields).taskId();
+  m_requestsInFlight.insert(taskId, cell);
+  ++m_requestCount;
+
+  if (clearCache)
+    m_clearCacheTaskId = taskId;
+}
+
+QString DisplayWfsLayer::requestStatus() const
+{
+  return QString("%1 cells populated, %2 requests in flight, %3 cells queued, %4 requests, %5 features")
+      .arg(m_populatedCells.size())
+      .arg(m_requestsInFlight.size())
+      .arg(m_pendingCells.size())
+      .arg(m_requestCount)
+      .arg(m_wfsFeatureTable ? m_wfsFeatureTable->numberOfFeatures() : 0);
 }
@@ -27,13 +27,21 @@ class WfsFeatureTable;
 }
 }
 
+#include "Envelope.h"
+
+#include <QHash>
+#include <QList>
 #include <QObject>
+#include <QPair>
+#include <QSet>
+#include <QUuid>
 
 class DisplayWfsLayer : public QObject
 {
   Q_OBJECT
 
   Q_PROPERTY(Esri::ArcGISRuntime::MapQuickView* mapView READ mapView WRITE setMapView NOTIFY mapViewChanged)
+  Q_PROPERTY(QString requestStatus READ requestStatus NOTIFY requestStatusChanged)
 
 public:
   explicit DisplayWfsLayer(QObject* parent = nullptr);
@@ -43,15 +51,29 @@ public:
 
 signals:
   void mapViewChanged();
+  void requestStatusChanged();
 
 private:
   Esri::ArcGISRuntime::MapQuickView* mapView() const;
   void setMapView(Esri::ArcGISRuntime::MapQuickView* mapView);
   void populateWfsFeatureTable();
+  // column and row of a cell in the fixed request grid
+  using Cell = QPair<int, int>;
+
+  void requestCells();
+  void startRequest(const Esri::ArcGISRuntime::Envelope& area, const Cell& cell, bool clearCache);
+  QString requestStatus() const;
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   Esri::ArcGISRuntime::WfsFeatureTable* m_wfsFeatureTable = nullptr;
+  QSet<Cell> m_populatedCells;
+  QList<Cell> m_pendingCells;
+  Esri::ArcGISRuntime::Envelope m_pendingExtent;
+  QHash<QUuid, Cell> m_requestsInFlight;
+  bool m_clearCachePending = false;
+  QUuid m_clearCacheTaskId;
+  int m_requestCount = 0;
 };
 
 #endif // DISPLAYWFSLAYER_H
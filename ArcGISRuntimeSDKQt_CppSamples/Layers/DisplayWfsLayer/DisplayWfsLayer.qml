@@ -24,6 +24,25 @@ Item {
     MapView {
         id: view
         anchors.fill: parent
+
+        Rectangle {
+            anchors {
+                left: parent.left
+                top: parent.top
+                margins: 5
+            }
+            width: statusText.width + 10
+            height: statusText.height + 10
+            color: "white"
+            opacity: 0.85
+            radius: 5
+
+            Text {
+                id: statusText
+                anchors.centerIn: parent
+                text: model.requestStatus
+            }
+        }
     }
 
     // Declare the C++ instance which creates the scene etc. and supply the view
@@ -21,6 +21,7 @@
 #include "IdentifyRasterCell.h"
 
 #include "CalloutData.h"
+#include "GeometryEngine.h"
 #include "Map.h"
 #include "MapQuickView.h"
 #include "Raster.h"
@@ -29,6 +30,9 @@
 
 #include <QDir>
 #include <QString>
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
 using namespace Esri::ArcGISRuntime;
@@ -50,12 +54,28 @@ QString defaultDataPath()
 
   return dataPath;
 }
+
+// the number of identified pixels kept in the cache
+constexpr int pixelCacheSize = 4096;
+// fraction of a pixel an identified cell may be off the pixel grid and still be cached
+constexpr double pixelGridTolerance = 0.01;
+// the number of recent identifies that the latency percentiles are taken from
+constexpr int latencySampleCount = 200;
+
+qint64 percentile(const QVector<qint64>& sortedLatencies, double fraction)
+{
+  const int index = qBound(0, qCeil(fraction * sortedLatencies.size()) - 1, sortedLatencies.size() - 1);
+  return sortedLatencies.at(index);
+}
 } // namespace
 
 IdentifyRasterCell::IdentifyRasterCell(QObject* parent /* = nullptr */):
   QObject(parent),
-  m_map(new Map(BasemapStyle::ArcGISOceans, this))
+  m_map(new Map(BasemapStyle::ArcGISOceans, this)),
+  m_pixelCache(pixelCacheSize)
 {
+  m_latencies.reserve(latencySampleCount);
+
   // initialize the raster layer
   const QString filepath = defaultDataPath() + "/ArcGIS/Runtime/Data/raster/SA_EVI_8Day_03May20/SA_EVI_8Day_03May20.tif";
   Raster* raster = new Raster(filepath, this);
@@ -105,9 +125,13 @@ void IdentifyRasterCell::connectSignals()
     m_mapView->setViewpointGeometry(m_rasterLayer->fullExtent());
   });
 
-  connect(m_mapView, &MapQuickView::identifyLayerCompleted, this, [this](QUuid, IdentifyLayerResult* rawIdentifyResult)
+  connect(m_mapView, &MapQuickView::identifyLayerCompleted, this, [this](QUuid taskId, IdentifyLayerResult* rawIdentifyResult)
   {
     auto identifyResult = std::unique_ptr<IdentifyLayerResult>(rawIdentifyResult);
+    if (taskId != m_identifyTaskId)
+      return;
+
+    recordLatency(m_identifyTimer.elapsed());
 
     for (GeoElement* geoElement : identifyResult->geoElements())
     {
@@ -123,30 +147,48 @@ void IdentifyRasterCell::connectSignals()
           calloutString.append(attributeNames[i] + ": " + value + "\n");
         }
 
-        const double xPoint = rasterCell->geometry().extent().xMin();
-        const double yPoint = rasterCell->geometry().extent().yMin();
+        const Envelope cellExtent = rasterCell->geometry().extent();
+        const double xPoint = cellExtent.xMin();
+        const double yPoint = cellExtent.yMin();
 
         calloutString.append("X: " + QString::number(xPoint, 'f', 2) + " Y: " + QString::number(yPoint, 'f', 2));
 
-        m_mapView->calloutData()->setLocation(m_clickedPoint);
-        m_mapView->calloutData()->setDetail(calloutString);
-        m_mapView->calloutData()->setVisible(true);
-        m_calloutData = m_mapView->calloutData();
-        emit calloutDataChanged();
+        // the first cell defines the pixel grid that later positions are looked up in
+        if (m_pixelGrid.isEmpty())
+          m_pixelGrid = cellExtent;
+
+        // the grid assumes uniform cells anchored at the first one, which does not
+        // hold everywhere once cells are projected; such cells are not cached
+        QPair<qint64, qint64> key;
+        if (cachedPixelKey(cellExtent.center(), key) && matchesPixelGrid(key, cellExtent))
+          m_pixelCache.insert(key, new QString(calloutString));
+
+        // a later cursor position supersedes this result; it is only cached
+        if (m_identifyGeneration == m_requestGeneration)
+          showCallout(m_clickedPoint, calloutString);
       }
     }
+
+    finishIdentify();
+  });
+
+  // a failed identify must not keep later ones waiting
+  connect(m_mapView, &MapQuickView::errorOccurred, this, [this](Error)
+  {
+    if (m_identifyTaskId.isNull())
+      return;
+
+    finishIdentify();
   });
 
   connect(m_mapView, &MapQuickView::mouseClicked, this, [this](const QMouseEvent& e)
   {
-    m_mapView->identifyLayer(m_rasterLayer, e.x(), e.y(), 10, false, 1);
-    m_clickedPoint = m_mapView->screenToLocation(e.x(), e.y());
+    requestIdentify(e.localPos());
   });
 
   connect(m_mapView, &MapQuickView::mousePressedAndHeld, this, [this](const QMouseEvent& e)
   {
-    m_mapView->identifyLayer(m_rasterLayer, e.x(), e.y(), 10, false, 1);
-    m_clickedPoint = m_mapView->screenToLocation(e.x(), e.y());
+    requestIdentify(e.localPos());
     m_mousePressed = true;
   });
 
@@ -159,11 +201,140 @@ void IdentifyRasterCell::connectSignals()
   connect(m_mapView, &MapQuickView::mouseMoved, this, [this](const QMouseEvent& e)
   {
     if (m_mousePressed)
+      requestIdentify(e.localPos());
+  });
+}
+
+// Identifies the pixel under the screen point. Pixels that were identified
+// before are answered from the cache; otherwise the identify is started, or,
+// if one is already in flight, the point replaces any earlier waiting point.
+void IdentifyRasterCell::requestIdentify(const QPointF& screenPoint)
+{
+  ++m_requestGeneration;
+
+  if (m_pixelCacheEnabled)
+  {
+    const Point location = m_mapView->screenToLocation(screenPoint.x(), screenPoint.y());
+    QPair<qint64, qint64> key;
+    if (cachedPixelKey(location, key))
     {
-      m_mapView->identifyLayer(m_rasterLayer, e.x(), e.y(), 10, false, 1);
-      m_clickedPoint = m_mapView->screenToLocation(e.x(), e.y());
+      if (const QString* detail = m_pixelCache.object(key))
+      {
+        ++m_cacheHits;
+        m_identifyPending = false;
+        showCallout(location, *detail);
+        emit latencySummaryChanged();
+        return;
+      }
     }
-  });
+  }
+
+  m_pendingScreenPoint = screenPoint;
+  m_identifyPending = true;
+
+  if (m_identifyTaskId.isNull())
+    startIdentify();
+}
+
+void IdentifyRasterCell::startIdentify()
+{
+  m_identifyPending = false;
+  m_identifyGeneration = m_requestGeneration;
+  m_clickedPoint = m_mapView->screenToLocation(m_pendingScreenPoint.x(), m_pendingScreenPoint.y());
+  m_identifyTimer.start();
+  m_identifyTaskId = m_mapView->identifyLayer(m_rasterLayer, m_pendingScreenPoint.x(), m_pendingScreenPoint.y(), 10, false, 1).taskId();
+}
+
+void IdentifyRasterCell::finishIdentify()
+{
+  m_identifyTaskId = QUuid();
+
+  // the cursor moved on while the identify was running
+  if (m_identifyPending)
+    startIdentify();
+}
+
+void IdentifyRasterCell::showCallout(const Point& location, const QString& detail)
+{
+  m_mapView->calloutData()->setLocation(location);
+  m_mapView->calloutData()->setDetail(detail);
+  m_mapView->calloutData()->setVisible(true);
+  m_calloutData = m_mapView->calloutData();
+  emit calloutDataChanged();
+}
+
+void IdentifyRasterCell::recordLatency(qint64 msecs)
+{
+  if (m_latencies.size() < latencySampleCount)
+    m_latencies.append(msecs);
+  else
+    m_latencies[m_nextLatency] = msecs;
+
+  m_nextLatency = (m_nextLatency + 1) % latencySampleCount;
+  emit latencySummaryChanged();
+}
+
+// Finds the column and row of the pixel containing the location, once the
+// pixel grid is known from an identified cell.
+bool IdentifyRasterCell::cachedPixelKey(const Point& location, QPair<qint64, qint64>& key) const
+{
+  if (m_pixelGrid.isEmpty() || location.isEmpty() || m_pixelGrid.width() <= 0 || m_pixelGrid.height() <= 0)
+    return false;
+
+  const Point gridLocation = location.spatialReference() == m_pixelGrid.spatialReference() ?
+                               location :
+                               Point(GeometryEngine::project(location, m_pixelGrid.spatialReference()));
+
+  key.first = qFloor((gridLocation.x() - m_pixelGrid.xMin()) / m_pixelGrid.width());
+  key.second = qFloor((gridLocation.y() - m_pixelGrid.yMin()) / m_pixelGrid.height());
+  return true;
+}
+
+// Checks that the bounds the grid computes for a key are those of the identified cell.
+bool IdentifyRasterCell::matchesPixelGrid(const QPair<qint64, qint64>& key, const Envelope& cellExtent) const
+{
+  if (cellExtent.spatialReference() != m_pixelGrid.spatialReference())
+    return false;
+
+  const double toleranceX = m_pixelGrid.width() * pixelGridTolerance;
+  const double toleranceY = m_pixelGrid.height() * pixelGridTolerance;
+  const double xMin = m_pixelGrid.xMin() + key.first * m_pixelGrid.width();
+  const double yMin = m_pixelGrid.yMin() + key.second * m_pixelGrid.height();
+
+  return std::abs(cellExtent.xMin() - xMin) <= toleranceX &&
+         std::abs(cellExtent.yMin() - yMin) <= toleranceY &&
+         std::abs(cellExtent.width() - m_pixelGrid.width()) <= toleranceX &&
+         std::abs(cellExtent.height() - m_pixelGrid.height()) <= toleranceY;
+}
+
+bool IdentifyRasterCell::pixelCacheEnabled() const
+{
+  return m_pixelCacheEnabled;
+}
+
+void IdentifyRasterCell::setPixelCacheEnabled(bool enabled)
+{
+  if (m_pixelCacheEnabled == enabled)
+    return;
+
+  m_pixelCacheEnabled = enabled;
+  emit pixelCacheEnabledChanged();
+}
+
+QString IdentifyRasterCell::latencySummary() const
+{
+  if (m_latencies.isEmpty())
+    return QString();
+
+  QVector<qint64> sortedLatencies = m_latencies;
+  std::sort(sortedLatencies.begin(), sortedLatencies.end());
+
+  return QString("identify p50 %1 ms, p90 %2 ms, p99 %3 ms (%4 identifies), %5 cache hits")
+      .arg(percentile(sortedLatencies, 0.5))
+      .arg(percentile(sortedLatencies, 0.9))
+      .arg(percentile(sortedLatencies, 0.99))
+      .arg(sortedLatencies.size())
+      .arg(m_cacheHits);
 }
 
 CalloutData* IdentifyRasterCell::calloutData() const
@@ -17,9 +17,16 @@
 #ifndef IDENTIFYRASTERCELL_H
 #define IDENTIFYRASTERCELL_H
 
+#include "Envelope.h"
 #include "Point.h"
 
+#include <QCache>
+#include <QElapsedTimer>
 #include <QObject>
+#include <QPair>
+#include <QPointF>
+#include <QUuid>
+#include <QVector>
 
 namespace Esri
 {
@@ -38,6 +45,8 @@ class IdentifyRasterCell : public QObject
 
   Q_PROPERTY(Esri::ArcGISRuntime::MapQuickView* mapView READ mapView WRITE setMapView NOTIFY mapViewChanged)
   Q_PROPERTY(Esri::ArcGISRuntime::CalloutData* calloutData READ calloutData NOTIFY calloutDataChanged)
+  Q_PROPERTY(bool pixelCacheEnabled READ pixelCacheEnabled WRITE setPixelCacheEnabled NOTIFY pixelCacheEnabledChanged)
+  Q_PROPERTY(QString latencySummary READ latencySummary NOTIFY latencySummaryChanged)
 
 public:
   explicit IdentifyRasterCell(QObject* parent = nullptr);
@@ -48,12 +57,24 @@ public:
 signals:
   void mapViewChanged();
   void calloutDataChanged();
+  void pixelCacheEnabledChanged();
+  void latencySummaryChanged();
 
 private:
   Esri::ArcGISRuntime::MapQuickView* mapView() const;
   void setMapView(Esri::ArcGISRuntime::MapQuickView* mapView);
   Esri::ArcGISRuntime::CalloutData* calloutData() const;
   void connectSignals();
+  bool pixelCacheEnabled() const;
+  void setPixelCacheEnabled(bool enabled);
+  QString latencySummary() const;
+  void requestIdentify(const QPointF& screenPoint);
+  void startIdentify();
+  void finishIdentify();
+  void showCallout(const Esri::ArcGISRuntime::Point& location, const QString& detail);
+  void recordLatency(qint64 msecs);
+  bool cachedPixelKey(const Esri::ArcGISRuntime::Point& location, QPair<qint64, qint64>& key) const;
+  bool matchesPixelGrid(const QPair<qint64, qint64>& key, const Esri::ArcGISRuntime::Envelope& cellExtent) const;
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
@@ -61,6 +82,25 @@ private:
   Esri::ArcGISRuntime::CalloutData* m_calloutData = nullptr;
   Esri::ArcGISRuntime::Point m_clickedPoint;
   bool m_mousePressed = false;
+
+  // at most one identify is in flight; the latest cursor position waits for it to finish
+  QUuid m_identifyTaskId;
+  QPointF m_pendingScreenPoint;
+  bool m_identifyPending = false;
+  // bumped for every cursor position; the identify in flight is only shown if it is the latest
+  quint64 m_requestGeneration = 0;
+  quint64 m_identifyGeneration = 0;
+  QElapsedTimer m_identifyTimer;
+
+  // callout text of identified pixels, keyed by column and row in the raster's pixel grid
+  bool m_pixelCacheEnabled = true;
+  QCache<QPair<qint64, qint64>, QString> m_pixelCache;
+  Esri::ArcGISRuntime::Envelope m_pixelGrid;
+  int m_cacheHits = 0;
+
+  // the most recent identify latencies, in milliseconds
+  QVector<qint64> m_latencies;
+  int m_nextLatency = 0;
 };
 
 #endif // IDENTIFYRASTERCELL_H
@@ -53,6 +53,35 @@ Item {
         }
     }
 
+    Rectangle {
+        anchors {
+            left: parent.left
+            top: parent.top
+            margins: 5
+        }
+        width: statsColumn.width + 10
+        height: statsColumn.height + 10
+        color: "white"
+        opacity: 0.85
+        radius: 5
+
+        Column {
+            id: statsColumn
+            anchors.centerIn: parent
+
+            CheckBox {
+                text: "Answer from pixel cache"
+                checked: model.pixelCacheEnabled
+                onCheckedChanged: model.pixelCacheEnabled = checked;
+            }
+
+            Text {
+                text: model.latencySummary
+                visible: text.length > 0
+            }
+        }
+    }
+
     // Declare the C++ instance which creates the scene etc. and supply the view
     IdentifyRasterCellSample {
         id: model
@@ -31,6 +31,8 @@
 #include "SceneQuickView.h"
 
 #include <QDir>
+#include <QElapsedTimer>
+#include <QTimer>
 #include <algorithm>
 
 using namespace Esri::ArcGISRuntime;
@@ -38,6 +40,9 @@ using namespace Esri::ArcGISRuntime;
 // helper method to get cross platform data path
 namespace
 {
+// time budget for each slice of background indexing, so the UI stays responsive
+constexpr qint64 indexSliceMs = 4;
+
 QString defaultDataPath()
 {
   QString dataPath;
@@ -56,8 +61,14 @@ QString defaultDataPath()
 
 ListKmlContents::ListKmlContents(QObject* parent /* = nullptr */):
   QObject(parent),
-  m_scene(new Scene(Basemap::imageryWithLabels(this), this))
+  m_scene(new Scene(Basemap::imageryWithLabels(this), this)),
+  m_indexTimer(new QTimer(this))
 {
+  // index the rest of the tree in small slices on the event loop; KML nodes
+  // belong to the dataset's thread so they cannot be walked from a worker
+  m_indexTimer->setInterval(0);
+  connect(m_indexTimer, &QTimer::timeout, this, &ListKmlContents::indexPendingNodes);
+
   // create a new elevation source from Terrain3D REST service
   ArcGISTiledElevationSource* elevationSource = new ArcGISTiledElevationSource(
         QUrl("https://elevation3d.arcgis.com/arcgis/rest/services/WorldElevation3D/Terrain3D/ImageServer"), this);
@@ -80,20 +91,29 @@ ListKmlContents::ListKmlContents(QObject* parent /* = nullptr */):
       return;
     }
 
-    // recursively build tree to display KML contents
-    for (KmlNode* node : m_kmlDataset->rootNodes())
+    // index only the root nodes up front; deeper levels are indexed when
+    // browsed or by the background indexer. Visibility is applied to the whole
+    // tree now so it does not depend on how far indexing has progressed.
+    const QList<KmlNode*> rootNodes = m_kmlDataset->rootNodes();
+    for (int i = 0; i < rootNodes.size(); ++i)
     {
-      m_kmlNodesList << node;
-      buildTree(node);
+      for (KmlNode* child : childNodes(rootNodes.at(i)))
+        showNodes(child);
+
+      registerNode(rootNodes.at(i), QString::number(i));
+      m_pendingNodes.enqueue(rootNodes.at(i));
     }
 
     // if at top node, then display children
-    if (!m_kmlNodesList.isEmpty() && m_kmlNodesList[0]->parentNode() == nullptr)
+    if (!rootNodes.isEmpty())
     {
-      m_currentNode = m_kmlNodesList[0];
+      m_currentNode = rootNodes.at(0);
+      refreshLevel();
       emit currentNodeChanged();
       emit levelNodeNamesChanged();
     }
+
+    m_indexTimer->start();
   });
 }
 
@@ -154,6 +174,7 @@ void ListKmlContents::displayPreviousLevel()
   if (grandparentNode != nullptr)
   {
     m_currentNode = grandparentNode;
+    refreshLevel();
     emit currentNodeChanged();
     emit labelTextChanged();
     emit levelNodeNamesChanged();
@@ -162,6 +183,7 @@ void ListKmlContents::displayPreviousLevel()
   else
   {
     m_currentNode = parentNode;
+    refreshLevel();
     emit currentNodeChanged();
     emit labelTextChanged();
     emit levelNodeNamesChanged();
@@ -169,49 +191,39 @@ void ListKmlContents::displayPreviousLevel()
 }
 
 // display selected node on sceneview and show its children
-void ListKmlContents::processSelectedNode(const QString& nodeName)
+void ListKmlContents::processSelectedNode(const QString& nodePath)
 {
-  // extract the node's name from the string, formatted "name - nodeType"
-  QString extractedNodeName = nodeName;
-  if (nodeName.contains(" - "))
+  // look up the node by its path, which stays unique even when names repeat
+  KmlNode* node = m_nodesByPath.value(nodePath, nullptr);
+  if (node == nullptr)
+    return;
+
+  // update current node
+  m_currentNode = node;
+  emit currentNodeChanged();
+  emit labelTextChanged();
+
+  m_viewpoint = Viewpoint();
+  getViewpointFromKmlViewpoint(node);
+  if (m_needsAltitudeFixed)
   {
-    int ind = nodeName.lastIndexOf(" - ");
-    extractedNodeName = nodeName.left(ind);
+    getAltitudeAdjustedViewpoint(node);
   }
-
-  // find node in the list
-  for (KmlNode* node : m_kmlNodesList)
+  else
   {
-    if (extractedNodeName == node->name())
-    {
-      // update current node
-      m_currentNode = node;
-      emit currentNodeChanged();
-      emit labelTextChanged();
-
-      m_viewpoint = Viewpoint();
-      getViewpointFromKmlViewpoint(node);
-      if (m_needsAltitudeFixed)
-      {
-        getAltitudeAdjustedViewpoint(node);
-      }
-      else
-      {
-        if (!m_viewpoint.isEmpty() && !m_viewpoint.targetGeometry().isEmpty())
-          m_sceneView->setViewpoint(m_viewpoint);
-      }
+    if (!m_viewpoint.isEmpty() && !m_viewpoint.targetGeometry().isEmpty())
+      m_sceneView->setViewpoint(m_viewpoint);
+  }
 
-      // reset m_lastLevel before levelNodeNames() is called
-      emit levelNodeNamesChanged();
+  // rebuild the level before the view reads levelNodeNames
+  refreshLevel();
+  emit levelNodeNamesChanged();
 
-      // if displaying end-nodes, change m_currentNode to first end-node for correct behavior of back button
-      if (noGrandchildren(m_currentNode))
-      {
-        m_currentNode = static_cast<KmlContainer*>(m_currentNode)->childNodesListModel()->at(0);
-        emit currentNodeChanged();
-      }
-      break;
-    }
+  // if displaying end-nodes, change m_currentNode to first end-node for correct behavior of back button
+  if (noGrandchildren(m_currentNode))
+  {
+    m_currentNode = expandNode(m_currentNode).first();
+    emit currentNodeChanged();
   }
 }
 
@@ -304,27 +316,120 @@ void ListKmlContents::getAltitudeAdjustedViewpoint(KmlNode* node)
   }
 }
 
-// recursively build list of all KML nodes
-void ListKmlContents::buildTree(KmlNode* parentNode)
+// child nodes of containers and network links, without dynamic_cast
+QList<KmlNode*> ListKmlContents::childNodes(KmlNode* node) const
+{
+  QList<KmlNode*> children;
+  if (node == nullptr)
+    return children;
+
+  switch (node->kmlNodeType())
+  {
+  case KmlNodeType::KmlDocument:
+  case KmlNodeType::KmlFolder:
+  {
+    const KmlNodeListModel* childModel = static_cast<KmlContainer*>(node)->childNodesListModel();
+    children.reserve(childModel->rowCount());
+    for (KmlNode* child : *childModel)
+      children << child;
+    break;
+  }
+  case KmlNodeType::KmlNetworkLink:
+    children = static_cast<KmlNetworkLink*>(node)->childNodes();
+    break;
+  default:
+    break;
+  }
+  return children;
+}
+
+bool ListKmlContents::hasChildNodes(KmlNode* node) const
 {
-  auto addNode = [this](KmlNode* node)
+  if (node == nullptr)
+    return false;
+
+  switch (node->kmlNodeType())
   {
-    // some nodes have default visibility set to false
-    node->setVisible(true);
+  case KmlNodeType::KmlDocument:
+  case KmlNodeType::KmlFolder:
+    return static_cast<KmlContainer*>(node)->childNodesListModel()->rowCount() > 0;
+  case KmlNodeType::KmlNetworkLink:
+    return !static_cast<KmlNetworkLink*>(node)->childNodes().isEmpty();
+  default:
+    return false;
+  }
+}
+
+// make a node and its descendants visible; some nodes have default visibility set to false
+void ListKmlContents::showNodes(KmlNode* node)
+{
+  node->setVisible(true);
+  for (KmlNode* child : childNodes(node))
+    showNodes(child);
+}
 
-    m_kmlNodesList << node;
-    buildTree(node);
-  };
+// index a node's immediate children the first time it is browsed or reached by the indexer
+QList<KmlNode*> ListKmlContents::expandNode(KmlNode* node)
+{
+  const QList<KmlNode*> children = childNodes(node);
+  if (m_expandedNodes.contains(node))
+    return children;
 
-  if (KmlContainer* container = dynamic_cast<KmlContainer*>(parentNode))
+  m_expandedNodes.insert(node);
+  const QString parentPath = m_pathsByNode.value(node);
+  for (int i = 0; i < children.size(); ++i)
   {
-    const KmlNodeListModel& childNodes = *container->childNodesListModel();
-    std::for_each(std::begin(childNodes), std::end(childNodes), addNode);
+    KmlNode* child = children.at(i);
+    registerNode(child, parentPath + '/' + QString::number(i));
+    m_pendingNodes.enqueue(child);
   }
-  else if (KmlNetworkLink* networkLink = dynamic_cast<KmlNetworkLink*>(parentNode))
+
+  if (!m_pendingNodes.isEmpty() && !m_indexTimer->isActive())
+    m_indexTimer->start();
+
+  return children;
+}
+
+void ListKmlContents::registerNode(KmlNode* node, const QString& path)
+{
+  m_nodesByPath.insert(path, node);
+  m_pathsByNode.insert(node, path);
+}
+
+// breadth-first indexing of the remaining tree, a few milliseconds at a time
+void ListKmlContents::indexPendingNodes()
+{
+  QElapsedTimer slice;
+  slice.start();
+
+  while (!m_pendingNodes.isEmpty() && slice.elapsed() < indexSliceMs)
+    expandNode(m_pendingNodes.dequeue());
+
+  if (m_pendingNodes.isEmpty())
+    m_indexTimer->stop();
+}
+
+// rebuild the names and paths of the current node's children
+void ListKmlContents::refreshLevel()
+{
+  // if node has no children, the displayed level is unchanged
+  if (!hasChildNodes(m_currentNode))
+    return;
+
+  m_levelNodeNames.clear();
+  m_levelNodePaths.clear();
+
+  for (KmlNode* node : expandNode(m_currentNode))
   {
-    const QList<KmlNode*> childNodes = networkLink->childNodes();
-    std::for_each(std::begin(childNodes), std::end(childNodes), addNode);
+    QString str = node->name() + " - " + getKmlNodeType(node);
+
+    // if node has children, add ">" to indicate further levels
+    if (hasChildNodes(node))
+    {
+      str.append(" >");
+    }
+    m_levelNodeNames << str;
+    m_levelNodePaths << m_pathsByNode.value(node);
   }
 }
 
@@ -447,53 +552,27 @@ void ListKmlContents::setSceneView(SceneQuickView* sceneView)
   emit sceneViewChanged();
 }
 
-QStringList ListKmlContents::levelNodeNames()
+QStringList ListKmlContents::levelNodeNames() const
 {
-  if (m_currentNode == nullptr)
-    return {};
-
-  QStringList nodeNames = {};
-
-  // if node is not a container, m_levelNodeNames will be unchanged
-  if (KmlContainer* container = dynamic_cast<KmlContainer*>(m_currentNode))
-  {
-    // for current level, get names of child nodes
-    for (KmlNode* node: *(container->childNodesListModel()))
-    {
-      QString str = node->name() + " - " + getKmlNodeType(node);
-
-      // if node has children, add ">" to indicate further levels
-      if (!node->children().isEmpty())
-      {
-        str.append(" >");
-      }
-      nodeNames << str;
-    }
-    m_levelNodeNames = nodeNames;
-  }
   return m_levelNodeNames;
 }
 
+QStringList ListKmlContents::levelNodePaths() const
+{
+  return m_levelNodePaths;
+}
+
 bool ListKmlContents::noGrandchildren(KmlNode *currentNode) const
 {
-  bool hasNoGrandchildren = false;
+  if (!hasChildNodes(currentNode))
+    return false;
 
-  if (KmlContainer* container = dynamic_cast<KmlContainer*>(currentNode))
+  // true when none of the current level's nodes have children of their own
+  const QList<KmlNode*> children = childNodes(currentNode);
+  return std::none_of(children.cbegin(), children.cend(), [this](KmlNode* node)
   {
-    hasNoGrandchildren = true;
-
-    // for current level, get names of child nodes
-    for (KmlNode* node: *(container->childNodesListModel()))
-    {
-      // if node has children, add ">" to indicate further levels
-      if (!node->children().isEmpty())
-      {
-        hasNoGrandchildren = false;
-      }
-    }
-  }
-
-  return hasNoGrandchildren;
+    return hasChildNodes(node);
+  });
 }
 
 QString ListKmlContents::labelText() const
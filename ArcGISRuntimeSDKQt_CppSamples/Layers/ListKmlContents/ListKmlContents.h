@@ -31,16 +31,22 @@ class SceneQuickView;
 }
 }
 
+#include <QHash>
 #include <QObject>
 #include <QList>
+#include <QQueue>
+#include <QSet>
 #include <QStringList>
 
+class QTimer;
+
 class ListKmlContents : public QObject
 {
   Q_OBJECT
 
   Q_PROPERTY(Esri::ArcGISRuntime::SceneQuickView* sceneView READ sceneView WRITE setSceneView NOTIFY sceneViewChanged)
   Q_PROPERTY(QStringList levelNodeNames READ levelNodeNames NOTIFY levelNodeNamesChanged)
+  Q_PROPERTY(QStringList levelNodePaths READ levelNodePaths NOTIFY levelNodeNamesChanged)
   Q_PROPERTY(bool isTopLevel READ isTopLevel NOTIFY currentNodeChanged)
   Q_PROPERTY(QString labelText READ labelText NOTIFY labelTextChanged)
 
@@ -49,7 +55,7 @@ public:
   ~ListKmlContents();
 
   static void init();
-  Q_INVOKABLE void processSelectedNode(const QString& nodeName);
+  Q_INVOKABLE void processSelectedNode(const QString& nodePath);
   Q_INVOKABLE void displayPreviousLevel();
 
 signals:
@@ -61,11 +67,18 @@ signals:
 private:
   Esri::ArcGISRuntime::SceneQuickView* sceneView() const;
   void setSceneView(Esri::ArcGISRuntime::SceneQuickView* sceneView);
-  QStringList levelNodeNames();
+  QStringList levelNodeNames() const;
+  QStringList levelNodePaths() const;
   QString labelText() const;
   bool isTopLevel() const;
 
-  void buildTree(Esri::ArcGISRuntime::KmlNode* parentNode);
+  QList<Esri::ArcGISRuntime::KmlNode*> childNodes(Esri::ArcGISRuntime::KmlNode* node) const;
+  bool hasChildNodes(Esri::ArcGISRuntime::KmlNode* node) const;
+  void showNodes(Esri::ArcGISRuntime::KmlNode* node);
+  QList<Esri::ArcGISRuntime::KmlNode*> expandNode(Esri::ArcGISRuntime::KmlNode* node);
+  void registerNode(Esri::ArcGISRuntime::KmlNode* node, const QString& path);
+  void indexPendingNodes();
+  void refreshLevel();
   QStringList buildPathLabel(Esri::ArcGISRuntime::KmlNode* node) const;
   QString getKmlNodeType(Esri::ArcGISRuntime::KmlNode* node);
   bool noGrandchildren(Esri::ArcGISRuntime::KmlNode* node) const;
@@ -76,7 +89,13 @@ private:
   Esri::ArcGISRuntime::SceneQuickView* m_sceneView = nullptr;
   Esri::ArcGISRuntime::KmlDataset* m_kmlDataset = nullptr;
   QStringList m_levelNodeNames = {};
-  QList<Esri::ArcGISRuntime::KmlNode*> m_kmlNodesList = {};
+  QStringList m_levelNodePaths = {};
+  // nodes are keyed by their child-index path from the root, e.g. "0/3/12"
+  QHash<QString, Esri::ArcGISRuntime::KmlNode*> m_nodesByPath;
+  QHash<Esri::ArcGISRuntime::KmlNode*, QString> m_pathsByNode;
+  QSet<Esri::ArcGISRuntime::KmlNode*> m_expandedNodes;
+  QQueue<Esri::ArcGISRuntime::KmlNode*> m_pendingNodes;
+  QTimer* m_indexTimer = nullptr;
   Esri::ArcGISRuntime::KmlNode* m_currentNode = nullptr;
   bool m_needsAltitudeFixed;
   Esri::ArcGISRuntime::Viewpoint m_viewpoint;
@@ -64,7 +64,7 @@ Item {
                         }
                         highlighted: pressed
                         onClicked: {
-                            sampleModel.processSelectedNode(text);
+                            sampleModel.processSelectedNode(sampleModel.levelNodePaths[index]);
                         }
                     }
                 }
@@ -25,6 +25,7 @@
 #include "LocalMapService.h"
 #include "LocalFeatureService.h"
 #include "LocalGeoprocessingService.h"
+#include "StatusEventListModel.h"
 
 #include <QDesktopServices>
 #include <QDir>
@@ -32,9 +33,48 @@
 
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+  // the most recent status changes that are kept in the log
+  constexpr int statusEventCapacity = 500;
+
+  // upper bounds of the latency histogram buckets; the last bucket is unbounded
+  constexpr qint64 latencyBucketBounds[] = {1000, 2000, 5000, 10000, 30000};
+  constexpr int latencyBucketCount = sizeof(latencyBucketBounds) / sizeof(latencyBucketBounds[0]) + 1;
+
+  QString statusName(LocalServerStatus status)
+  {
+    switch (status)
+    {
+      case LocalServerStatus::Starting:
+        return QStringLiteral("STARTING");
+      case LocalServerStatus::Started:
+        return QStringLiteral("STARTED");
+      case LocalServerStatus::Stopping:
+        return QStringLiteral("STOPPING");
+      case LocalServerStatus::Stopped:
+        return QStringLiteral("STOPPED");
+      case LocalServerStatus::Failed:
+        return QStringLiteral("FAILED");
+      default:
+        return QString();
+    }
+  }
+
+  int latencyBucket(qint64 msecs)
+  {
+    int bucket = 0;
+    while (bucket < latencyBucketCount - 1 && msecs >= latencyBucketBounds[bucket])
+      ++bucket;
+
+    return bucket;
+  }
+}
+
 LocalServerServices::LocalServerServices(QQuickItem* parent) :
   QQuickItem(parent),
-  m_dataPath(QDir::homePath() + "/ArcGIS/Runtime/Data")
+  m_dataPath(QDir::homePath() + "/ArcGIS/Runtime/Data"),
+  m_statusEvents(new StatusEventListModel(statusEventCapacity, this))
 {
   // create temp/data path
   const QString tempPath = LocalServerServices::shortestTempPath() + "/EsriQtSample";
@@ -82,42 +122,28 @@ void LocalServerServices::connectSignals()
   // local server status
   connect(LocalServer::instance(), &LocalServer::statusChanged, this, [this]()
   {
-    // append to the status string
-    switch (LocalServer::status())
+    const LocalServerStatus status = LocalServer::status();
+
+    // log the status change
+    recordTransition(LocalServer::instance(), "Server", QUrl(), status);
+
+    switch (status)
     {
-      case LocalServerStatus::Starting:
-      {
-        m_serverStatus.append("Server Status: STARTING\n");
-        break;
-      }
       case LocalServerStatus::Started:
       {
-        m_serverStatus.append("Server Status: STARTED\n");
         m_isServerRunning = true;
         emit isServerRunningChanged();
         break;
       }
-      case LocalServerStatus::Stopping:
-      {
-        m_serverStatus.append("Server Status: STOPPING\n");
-        break;
-      }
       case LocalServerStatus::Stopped:
       {
-        m_serverStatus.append("Server Status: STOPPED\n");
         m_isServerRunning = false;
         emit isServerRunningChanged();
         break;
       }
-      case LocalServerStatus::Failed:
-      {
-        m_serverStatus.append("Server Status: FAILED\n");
-        break;
-      }
       default:
         break;
     }
-    emit serverStatusChanged();
   });
 
   connect(m_localMapService, &LocalMapService::statusChanged, this, [this]()
@@ -143,7 +169,7 @@ void LocalServerServices::startLocalServer()
     return;
 
   // clear all the status messages
-  m_serverStatus.clear();
+  m_statusEvents->clear();
   // start local server
   LocalServer::start();
 }
@@ -242,60 +268,142 @@ bool LocalServerServices::isAnyServiceRunning()
   return LocalServer::services().size() > 0;
 }
 
-// get the current list of services from local server
-void LocalServerServices::getCurrentServices()
+// add a started service to the list of running services
+void LocalServerServices::addService(LocalService* service)
 {
-  // get the service names by looping through the services
-  m_services.clear();
-  for (const LocalService* service : LocalServer::services())
+  const QString url = service->url().toString();
+  if (!m_services.contains(url))
   {
-    m_services << service->url().toString();
+    m_services << url;
+    emit servicesChanged();
   }
-  emit servicesChanged();
+
+  m_servicesHash.insert(service->url(), service);
+}
+
+// remove a stopped service from the list of running services
+void LocalServerServices::removeService(LocalService* service)
+{
+  if (m_services.removeOne(service->url().toString()))
+    emit servicesChanged();
+
+  m_servicesHash.remove(service->url());
 }
 
 // get the current status of any service
 void LocalServerServices::updateStatus(LocalService* service, const QString& serviceName)
 {
-  switch (service->status())
+  const LocalServerStatus status = service->status();
+
+  // log the status change
+  recordTransition(service, serviceName + " Service", service->url(), status);
+
+  switch (status)
   {
-    case LocalServerStatus::Starting:
-    {
-      m_serverStatus.append(serviceName + " Service Status: STARTING\n");
-      break;
-    }
     case LocalServerStatus::Started:
     {
-      m_serverStatus.append(serviceName + " Service Status: STARTED\n");
       m_isServiceRunning = true;
       emit isServiceRunningChanged();
 
-      getCurrentServices();
-      m_servicesHash.insert(service->url(), service);
-      break;
-    }
-    case LocalServerStatus::Stopping:
-    {
-      m_serverStatus.append(serviceName + " Service Status: STOPPING\n");
+      addService(service);
       break;
     }
     case LocalServerStatus::Stopped:
     {
-      m_serverStatus.append(serviceName + " Service Status: STOPPED\n");
       if (!isAnyServiceRunning())
       {
         m_isServiceRunning = false;
         emit isServiceRunningChanged();
       }
 
-      getCurrentServices();
-      m_servicesHash.remove(service->url());
+      removeService(service);
       break;
     }
     default:
       break;
   }
-  emit serverStatusChanged();
+}
+
+// log a status change and time how long starting or stopping took
+void LocalServerServices::recordTransition(QObject* source, const QString& sourceName, const QUrl& serviceUrl, LocalServerStatus status)
+{
+  m_statusEvents->appendEvent(sourceName, serviceUrl, statusName(status));
+
+  switch (status)
+  {
+    case LocalServerStatus::Starting:
+    case LocalServerStatus::Stopping:
+    {
+      m_transitionTimers[source].start();
+      break;
+    }
+    case LocalServerStatus::Started:
+    case LocalServerStatus::Stopped:
+    {
+      auto it = m_transitionTimers.find(source);
+      if (it == m_transitionTimers.end())
+        break;
+
+      const qint64 elapsed = it->elapsed();
+      m_transitionTimers.erase(it);
+
+      const QString name = sourceName + (status == LocalServerStatus::Started ? " start" : " stop");
+      LatencyHistogram& histogram = m_latencyHistograms[name];
+      if (histogram.counts.isEmpty())
+        histogram.counts.fill(0, latencyBucketCount);
+
+      ++histogram.counts[latencyBucket(elapsed)];
+      histogram.totalMsecs += elapsed;
+      ++histogram.samples;
+      emit latencyHistogramsChanged();
+      break;
+    }
+    default:
+    {
+      // a failed transition is not counted
+      m_transitionTimers.remove(source);
+      break;
+    }
+  }
+}
+
+QAbstractListModel* LocalServerServices::statusEvents() const
+{
+  return m_statusEvents;
+}
+
+QStringList LocalServerServices::latencyBuckets() const
+{
+  QStringList buckets;
+  qint64 lowerBound = 0;
+  for (qint64 upperBound : latencyBucketBounds)
+  {
+    buckets << QString("%1-%2s").arg(lowerBound / 1000).arg(upperBound / 1000);
+    lowerBound = upperBound;
+  }
+  buckets << QString(">%1s").arg(lowerBound / 1000);
+
+  return buckets;
+}
+
+QVariantList LocalServerServices::latencyHistograms() const
+{
+  QVariantList histograms;
+  for (auto it = m_latencyHistograms.cbegin(); it != m_latencyHistograms.cend(); ++it)
+  {
+    QVariantList counts;
+    for (int count : it->counts)
+      counts << count;
+
+    QVariantMap histogram;
+    histogram["name"] = it.key();
+    histogram["counts"] = counts;
+    histogram["samples"] = it->samples;
+    histogram["meanMsecs"] = it->samples > 0 ? it->totalMsecs / it->samples : 0;
+    histograms << histogram;
+  }
+
+  return histograms;
 }
 
 QString LocalServerServices::shortestTempPath()
@@ -30,16 +30,25 @@ namespace Esri
 }
 
 class QTemporaryDir;
+class StatusEventListModel;
+
+#include "LocalServerTypes.h"
 
 #include <memory>
+#include <QAbstractListModel>
+#include <QElapsedTimer>
+#include <QMap>
 #include <QQuickItem>
+#include <QVector>
 
 class LocalServerServices : public QQuickItem
 {
   Q_OBJECT
 
   Q_PROPERTY(QStringList servicesList MEMBER m_services NOTIFY servicesChanged)
-  Q_PROPERTY(QString serverStatus MEMBER m_serverStatus NOTIFY serverStatusChanged)
+  Q_PROPERTY(QAbstractListModel* statusEvents READ statusEvents CONSTANT)
+  Q_PROPERTY(QStringList latencyBuckets READ latencyBuckets CONSTANT)
+  Q_PROPERTY(QVariantList latencyHistograms READ latencyHistograms NOTIFY latencyHistogramsChanged)
   Q_PROPERTY(bool isServerRunning MEMBER m_isServerRunning NOTIFY isServerRunningChanged)
   Q_PROPERTY(bool isServiceRunning MEMBER m_isServiceRunning NOTIFY isServiceRunningChanged)
   Q_PROPERTY(QString dataPath MEMBER m_dataPath NOTIFY dataPathChanged)
@@ -58,7 +67,7 @@ public:
 
 signals:
   void servicesChanged();
-  void serverStatusChanged();
+  void latencyHistogramsChanged();
   void isServerRunningChanged();
   void isServiceRunningChanged();
   void dataPathChanged();
@@ -67,15 +76,32 @@ private:
   void connectSignals();
   bool isAnyServiceRunning();
   void updateStatus(Esri::ArcGISRuntime::LocalService* service, const QString& serviceName);
-  void getCurrentServices();
+  void recordTransition(QObject* source, const QString& sourceName, const QUrl& serviceUrl,
+                        Esri::ArcGISRuntime::LocalServerStatus status);
+  void addService(Esri::ArcGISRuntime::LocalService* service);
+  void removeService(Esri::ArcGISRuntime::LocalService* service);
+  QAbstractListModel* statusEvents() const;
+  QStringList latencyBuckets() const;
+  QVariantList latencyHistograms() const;
   static QString shortestTempPath();
 
+  // counts how long start or stop transitions took, in the buckets named by latencyBuckets()
+  struct LatencyHistogram
+  {
+    QVector<int> counts;
+    qint64 totalMsecs = 0;
+    int samples = 0;
+  };
+
 private:
   Esri::ArcGISRuntime::LocalMapService* m_localMapService = nullptr;
   Esri::ArcGISRuntime::LocalFeatureService* m_localFeatureService = nullptr;
   Esri::ArcGISRuntime::LocalGeoprocessingService* m_localGPService = nullptr;
   QStringList m_services;
-  QString m_serverStatus;
+  StatusEventListModel* m_statusEvents = nullptr;
+  // when the server or a service started its current transition, keyed by the object changing state
+  QHash<QObject*, QElapsedTimer> m_transitionTimers;
+  QMap<QString, LatencyHistogram> m_latencyHistograms;
   QString m_dataPath;
   bool m_isServerRunning = false;
   bool m_isServiceRunning = false;
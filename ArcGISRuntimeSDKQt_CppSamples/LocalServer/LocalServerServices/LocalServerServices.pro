@@ -33,11 +33,13 @@ TARGET = LocalServerServices
 #-------------------------------------------------------------------------------
 
 HEADERS += \
-    LocalServerServices.h
+    LocalServerServices.h \
+    StatusEventListModel.h
 
 SOURCES += \
     main.cpp \
-    LocalServerServices.cpp
+    LocalServerServices.cpp \
+    StatusEventListModel.cpp
 
 RESOURCES += LocalServerServices.qrc
 
@@ -129,11 +129,33 @@ LocalServerServicesSample {
             }
         }
 
-        TextArea {
-            id: serverStatusTextArea
+        ListView {
+            id: serverStatusView
             width: startButton.width + servicesCombo.width + (10)
             height: 200
-            text: serverStatus
+            clip: true
+            model: statusEvents
+            // keep the latest status change in view
+            onCountChanged: positionViewAtEnd()
+
+            delegate: Text {
+                width: serverStatusView.width
+                text: timestamp + "  " + source + " Status: " + status + (serviceUrl.length > 0 ? "  " + serviceUrl : "")
+                elide: Text.ElideRight
+            }
+        }
+
+        Text {
+            text: "Start/stop latency (" + latencyBuckets.join(", ") + ")"
+            visible: latencyHistograms.length > 0
+        }
+
+        Repeater {
+            model: latencyHistograms
+
+            Text {
+                text: modelData.name + ": " + modelData.counts.join(", ") + "  (n=" + modelData.samples + ", mean " + modelData.meanMsecs + " ms)"
+            }
         }
 
         Text {
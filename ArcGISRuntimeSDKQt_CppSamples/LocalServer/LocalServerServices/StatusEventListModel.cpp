@@ -0,0 +1,94 @@
+// [WriteFile Name=LocalServerServices, Category=LocalServer]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "StatusEventListModel.h"
+
+StatusEventListModel::StatusEventListModel(int capacity, QObject* parent /* = nullptr */):
+  QAbstractListModel(parent),
+  m_events(qMax(1, capacity))
+{
+}
+
+void StatusEventListModel::appendEvent(const QString& source, const QUrl& serviceUrl, const QString& status)
+{
+  // drop the oldest event to make room
+  if (m_count == m_events.size())
+  {
+    beginRemoveRows(QModelIndex(), 0, 0);
+    m_first = (m_first + 1) % m_events.size();
+    --m_count;
+    endRemoveRows();
+  }
+
+  beginInsertRows(QModelIndex(), m_count, m_count);
+  StatusEvent& event = m_events[(m_first + m_count) % m_events.size()];
+  event.timestamp = QDateTime::currentDateTime();
+  event.source = source;
+  event.serviceUrl = serviceUrl;
+  event.status = status;
+  ++m_count;
+  endInsertRows();
+}
+
+void StatusEventListModel::clear()
+{
+  beginResetModel();
+  m_first = 0;
+  m_count = 0;
+  endResetModel();
+}
+
+int StatusEventListModel::rowCount(const QModelIndex& parent) const
+{
+  Q_UNUSED(parent);
+  return m_count;
+}
+
+QVariant StatusEventListModel::data(const QModelIndex& index, int role) const
+{
+  if (index.row() < 0 || index.row() >= m_count)
+    return QVariant();
+
+  const StatusEvent& event = m_events.at((m_first + index.row()) % m_events.size());
+
+  switch (role)
+  {
+  case TimestampRole:
+    return event.timestamp.toString(QStringLiteral("hh:mm:ss.zzz"));
+  case SourceRole:
+    return event.source;
+  case ServiceUrlRole:
+    return event.serviceUrl.toString();
+  case StatusRole:
+    return event.status;
+  default:
+    return QVariant();
+  }
+}
+
+QHash<int, QByteArray> StatusEventListModel::roleNames() const
+{
+  return {
+    {TimestampRole, "timestamp"},
+    {SourceRole, "source"},
+    {ServiceUrlRole, "serviceUrl"},
+    {StatusRole, "status"}
+  };
+}
@@ -0,0 +1,71 @@
+// [WriteFile Name=LocalServerServices, Category=LocalServer]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef STATUSEVENTLISTMODEL_H
+#define STATUSEVENTLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QUrl>
+#include <QVector>
+
+// A fixed-capacity log of server and service status changes. Events are
+// stored in a ring buffer; once it is full each new event replaces the
+// oldest one, and views are only told about the rows that changed.
+class StatusEventListModel : public QAbstractListModel
+{
+  Q_OBJECT
+
+public:
+  enum StatusEventRoles
+  {
+    TimestampRole = Qt::UserRole + 1,
+    SourceRole,
+    ServiceUrlRole,
+    StatusRole
+  };
+
+  struct StatusEvent
+  {
+    QDateTime timestamp;
+    QString source;
+    QUrl serviceUrl;
+    QString status;
+  };
+
+  explicit StatusEventListModel(int capacity, QObject* parent = nullptr);
+  ~StatusEventListModel() override = default;
+
+  void appendEvent(const QString& source, const QUrl& serviceUrl, const QString& status);
+  void clear();
+  int capacity() const { return m_events.size(); }
+
+  // QAbstractItemModel interface
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+protected:
+  QHash<int, QByteArray> roleNames() const override;
+
+private:
+  QVector<StatusEvent> m_events;
+  int m_first = 0;
+  int m_count = 0;
+};
+
+#endif // STATUSEVENTLISTMODEL_H
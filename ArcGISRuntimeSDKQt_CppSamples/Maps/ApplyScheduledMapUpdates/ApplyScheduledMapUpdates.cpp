@@ -19,6 +19,7 @@
 #endif // PCH_BUILD
 
 #include "ApplyScheduledMapUpdates.h"
+#include "DirectoryCopier.h"
 
 #include "Map.h"
 #include "MapQuickView.h"
@@ -29,13 +30,8 @@
 #include "OfflineMapSyncJob.h"
 
 #include <QDir>
-#include <QFile>
-#include <QFileInfo>
-#include <QtCore/qglobal.h>
-
-#ifdef Q_OS_IOS
 #include <QStandardPaths>
-#endif // Q_OS_IOS
+#include <QtCore/qglobal.h>
 
 using namespace Esri::ArcGISRuntime;
 
@@ -60,51 +56,46 @@ QString defaultDataPath()
 // sample MMPK location
 const QString sampleMmpk { "canyonlands" };
 
-// helper to copy directory from source to destination
-bool copyDir(const QString &srcPath, const QString &dstPath)
+// helper to format a byte count for display
+QString megabytes(double bytes)
 {
-  const QDir parentDstDir(QFileInfo(dstPath).path());
-  if (!parentDstDir.mkdir(QFileInfo(dstPath).fileName()))
-    return false;
+  return QString::number(bytes / (1024.0 * 1024.0), 'f', 1);
+}
+}
 
-  const QDir srcDir(srcPath);
-  for (const QFileInfo &info : srcDir.entryInfoList(QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot))
+ApplyScheduledMapUpdates::ApplyScheduledMapUpdates(QObject* parent /* = nullptr */):
+  QObject(parent),
+  m_copier(new DirectoryCopier(this)),
+  m_workingCopyPath(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/ApplyScheduledMapUpdates/" + sampleMmpk)
+{
+  connect(m_copier, &DirectoryCopier::progressChanged, this, [this](qint64 bytesCopied, qint64 bytesTotal, double bytesPerSecond)
   {
-    const QString srcItemPath = srcPath + "/" + info.fileName();
-    const QString dstItemPath = dstPath + "/" + info.fileName();
-    if (info.isDir())
-    {
-      if (!copyDir(srcItemPath, dstItemPath))
-      {
-        return false;
-      }
-    }
-    else if (info.isFile())
-    {
-      if (!QFile::copy(srcItemPath, dstItemPath))
-      {
-        return false;
-      }
-    }
-    else
+    emit updateUi(false, "Copying mobile map package",
+                  QString("%1 of %2 MB (%3 MB/s)").arg(megabytes(bytesCopied), megabytes(bytesTotal), megabytes(bytesPerSecond)));
+  });
+
+  connect(m_copier, &DirectoryCopier::finished, this, [this](bool success, const QString& errorMessage)
+  {
+    if (!success)
     {
-      qDebug() << "Unhandled item" << info.filePath() << "in copyDir";
+      emit updateUi(false, "Could not copy the mobile map package", errorMessage);
+      return;
     }
-  }
-  return true;
-}
+
+    loadMobileMapPackage();
+  });
+
+  // For the purposes of demonstrating the sample, work on a copy of the local
+  // offline map files so that updating does not overwrite them permanently.
+  // The copy is kept between runs; files that were not changed by a previous
+  // update are skipped and the ones that were are restored from the original.
+  m_copier->start(defaultDataPath() + "/" + sampleMmpk, m_workingCopyPath);
 }
 
-ApplyScheduledMapUpdates::ApplyScheduledMapUpdates(QObject* parent /* = nullptr */):
-  QObject(parent)
+void ApplyScheduledMapUpdates::loadMobileMapPackage()
 {
-  // For the purposes of demonstrating the sample,
-  // create a temporary copy of the local offline map files,
-  // so that updating does not overwrite them permanently
-  copyDir(defaultDataPath() + "/" + sampleMmpk, m_TempDir.path() + "/" + sampleMmpk);
-
   // create MMPK
-  m_mobileMapPackage = new MobileMapPackage(m_TempDir.path() + "/" + sampleMmpk, this);
+  m_mobileMapPackage = new MobileMapPackage(m_workingCopyPath, this);
 
   // load mmpk
   connect(m_mobileMapPackage, &MobileMapPackage::doneLoading, this, &ApplyScheduledMapUpdates::onMmpkDoneLoading);
@@ -231,9 +222,7 @@ void ApplyScheduledMapUpdates::connectSyncSignals()
         disconnect(m_mobileMapPackage, &MobileMapPackage::doneLoading, this, &ApplyScheduledMapUpdates::onMmpkDoneLoading);
 
         // load mmpk again with new instance
-        m_mobileMapPackage = new MobileMapPackage(m_TempDir.path() + "/" + sampleMmpk, this);
-        connect(m_mobileMapPackage, &MobileMapPackage::doneLoading, this, &ApplyScheduledMapUpdates::onMmpkDoneLoading);
-        m_mobileMapPackage->load();
+        loadMobileMapPackage();
       }
 
       // re-check if updates are available
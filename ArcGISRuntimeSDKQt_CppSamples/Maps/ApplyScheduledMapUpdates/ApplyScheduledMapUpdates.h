@@ -31,7 +31,8 @@ class OfflineMapSyncJob;
 
 #include "Error.h"
 #include <QObject>
-#include <QTemporaryDir>
+
+class DirectoryCopier;
 
 class ApplyScheduledMapUpdates : public QObject
 {
@@ -55,6 +56,7 @@ private:
   void setMapView(Esri::ArcGISRuntime::MapQuickView* mapView);
   void connectSyncSignals();
   void setMapToMapView();
+  void loadMobileMapPackage();
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
@@ -62,7 +64,8 @@ private:
   Esri::ArcGISRuntime::OfflineMapSyncTask* m_offlineSyncTask = nullptr;
   Esri::ArcGISRuntime::OfflineMapSyncJob* m_syncJob = nullptr;
   QMetaObject::Connection m_syncJobConnection;
-  QTemporaryDir m_TempDir;
+  DirectoryCopier* m_copier = nullptr;
+  QString m_workingCopyPath;
 
 private slots:
   void onMmpkDoneLoading(Esri::ArcGISRuntime::Error e);
@@ -33,11 +33,13 @@ include($$PWD/arcgisruntime.pri)
 #-------------------------------------------------------------------------------
 
 HEADERS += \
-    ApplyScheduledMapUpdates.h
+    ApplyScheduledMapUpdates.h \
+    DirectoryCopier.h
 
 SOURCES += \
     main.cpp \
-    ApplyScheduledMapUpdates.cpp
+    ApplyScheduledMapUpdates.cpp \
+    DirectoryCopier.cpp
 
 RESOURCES += ApplyScheduledMapUpdates.qrc
 
@@ -0,0 +1,337 @@
+// [WriteFile Name=ApplyScheduledMapUpdates, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "DirectoryCopier.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QThread>
+#include <QTimer>
+
+#include <utility>
+#include <vector>
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_ANDROID)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(Q_OS_DARWIN)
+#include <sys/clonefile.h>
+#endif
+
+namespace
+{
+// chunk size for copying file contents, also the granularity of the progress
+constexpr qint64 chunkSize = 4 * 1024 * 1024;
+constexpr int progressInterval = 200;
+
+struct FileTask
+{
+  QString sourcePath;
+  QString destinationPath;
+  qint64 size = 0;
+};
+
+bool isUnchanged(const QFileInfo& source, const QFileInfo& destination)
+{
+  return destination.exists() && destination.isFile() &&
+         destination.size() == source.size() &&
+         destination.lastModified() == source.lastModified();
+}
+
+bool removePath(const QFileInfo& info)
+{
+  if (info.isDir() && !info.isSymLink())
+    return QDir(info.filePath()).removeRecursively();
+
+  return QFile::remove(info.filePath());
+}
+} // namespace
+
+DirectoryCopier::DirectoryCopier(QObject* parent) :
+  QObject(parent),
+  m_progressTimer(new QTimer(this))
+{
+  // several files in flight hide per-file latency; the disk is the limit beyond that
+  m_pool.setMaxThreadCount(qBound(2, QThread::idealThreadCount(), 4));
+
+  m_progressTimer->setInterval(progressInterval);
+  connect(m_progressTimer, &QTimer::timeout, this, &DirectoryCopier::reportProgress);
+}
+
+DirectoryCopier::~DirectoryCopier()
+{
+  cancel();
+  m_pool.waitForDone();
+}
+
+void DirectoryCopier::start(const QString& sourcePath, const QString& destinationPath)
+{
+  if (m_running)
+    return;
+
+  m_running = true;
+  m_cancelled = false;
+  m_failed = false;
+  m_pendingFiles = 0;
+  m_filesCopied = 0;
+  m_filesSkipped = 0;
+  m_bytesTotal = 0;
+  m_bytesCopied = 0;
+  m_errorMessage.clear();
+
+  m_clock.start();
+  m_progressTimer->start();
+
+  // walking the tree touches the disk too, so it runs on the pool as well
+  m_pool.start(QRunnable::create([this, sourcePath, destinationPath]()
+  {
+    plan(sourcePath, destinationPath);
+  }));
+}
+
+void DirectoryCopier::cancel()
+{
+  m_cancelled = true;
+}
+
+bool DirectoryCopier::isRunning() const
+{
+  return m_running;
+}
+
+void DirectoryCopier::setMaxThreadCount(int threadCount)
+{
+  m_pool.setMaxThreadCount(threadCount);
+}
+
+// Runs on the pool: mirrors the directory structure and queues a task for
+// every file that needs copying.
+void DirectoryCopier::plan(const QString& sourcePath, const QString& destinationPath)
+{
+  std::vector<FileTask> files;
+  std::vector<std::pair<QString, QString>> directories{{sourcePath, destinationPath}};
+
+  while (!directories.empty() && !m_cancelled)
+  {
+    const std::pair<QString, QString> directory = directories.back();
+    directories.pop_back();
+
+    if (!mirrorDirectory(directory.first, directory.second))
+    {
+      fail(QString("Could not create %1").arg(directory.second));
+      break;
+    }
+
+    const QDir sourceDir(directory.first);
+    for (const QFileInfo& info : sourceDir.entryInfoList(QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden))
+    {
+      const QString destinationItemPath = directory.second + "/" + info.fileName();
+      if (info.isDir())
+      {
+        directories.emplace_back(info.filePath(), destinationItemPath);
+      }
+      else if (info.isFile())
+      {
+        if (isUnchanged(info, QFileInfo(destinationItemPath)))
+        {
+          ++m_filesSkipped;
+          continue;
+        }
+
+        files.push_back(FileTask{info.filePath(), destinationItemPath, info.size()});
+        m_bytesTotal += info.size();
+      }
+      else
+      {
+        qDebug() << "Unhandled item" << info.filePath() << "in DirectoryCopier";
+      }
+    }
+  }
+
+  if (files.empty() || m_failed || m_cancelled)
+  {
+    QMetaObject::invokeMethod(this, [this]() { complete(); }, Qt::QueuedConnection);
+    return;
+  }
+
+  m_pendingFiles = static_cast<int>(files.size());
+  for (const FileTask& file : files)
+  {
+    m_pool.start(QRunnable::create([this, file]()
+    {
+      copyFile(file.sourcePath, file.destinationPath, file.size);
+    }));
+  }
+}
+
+// Creates the destination directory and removes entries the source no longer has.
+bool DirectoryCopier::mirrorDirectory(const QString& sourcePath, const QString& destinationPath)
+{
+  if (!QDir().mkpath(destinationPath))
+    return false;
+
+  const QDir sourceDir(sourcePath);
+  const QDir destinationDir(destinationPath);
+  for (const QFileInfo& info : destinationDir.entryInfoList(QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System))
+  {
+    const QFileInfo sourceInfo(sourceDir.filePath(info.fileName()));
+    if (sourceInfo.exists() && sourceInfo.isDir() == info.isDir())
+      continue;
+
+    if (!removePath(info))
+      return false;
+  }
+  return true;
+}
+
+void DirectoryCopier::copyFile(const QString& sourcePath, const QString& destinationPath, qint64 size)
+{
+  if (!m_cancelled && !m_failed)
+  {
+    qint64 copied = 0;
+    if (copyFileContents(sourcePath, destinationPath, copied))
+    {
+      // keep the source's modification time so the next run can skip the file
+      QFile destination(destinationPath);
+      if (destination.open(QIODevice::ReadWrite))
+        destination.setFileTime(QFileInfo(sourcePath).lastModified(), QFileDevice::FileModificationTime);
+
+      // clones do not report progress, so account for the rest of the file here
+      m_bytesCopied += size - copied;
+      ++m_filesCopied;
+    }
+    else if (!m_cancelled)
+    {
+      QFile::remove(destinationPath);
+      fail(QString("Could not copy %1").arg(sourcePath));
+    }
+  }
+
+  if (--m_pendingFiles == 0)
+    QMetaObject::invokeMethod(this, [this]() { complete(); }, Qt::QueuedConnection);
+}
+
+// Clones the file where the file system supports it (reflinks on Linux,
+// clonefile on Apple platforms), otherwise copies it inside the kernel with
+// copy_file_range, and falls back to a buffered copy.
+bool DirectoryCopier::copyFileContents(const QString& sourcePath, const QString& destinationPath, qint64& copied)
+{
+  QFile::remove(destinationPath);
+
+#if defined(Q_OS_DARWIN)
+  if (clonefile(QFile::encodeName(sourcePath).constData(), QFile::encodeName(destinationPath).constData(), 0) == 0)
+    return true;
+#endif
+
+  QFile source(sourcePath);
+  QFile destination(destinationPath);
+  if (!source.open(QIODevice::ReadOnly) || !destination.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    return false;
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_ANDROID)
+  const int sourceFd = source.handle();
+  const int destinationFd = destination.handle();
+
+#ifdef FICLONE
+  if (ioctl(destinationFd, FICLONE, sourceFd) == 0)
+    return true;
+#endif
+
+#ifdef SYS_copy_file_range
+  bool kernelCopy = true;
+  while (!m_cancelled)
+  {
+    const ssize_t count = syscall(SYS_copy_file_range, sourceFd, nullptr, destinationFd, nullptr,
+                                  static_cast<size_t>(chunkSize), 0u);
+    if (count == 0)
+      return true;
+    if (count < 0)
+    {
+      // not supported for this pair of file systems; copy whatever is left in user space
+      kernelCopy = false;
+      break;
+    }
+    copied += count;
+    m_bytesCopied += count;
+  }
+  if (kernelCopy)
+    return false;
+
+  // continue from where the kernel copy stopped
+  if (!source.seek(copied) || !destination.seek(copied))
+    return false;
+#endif
+#endif
+
+  QByteArray buffer;
+  buffer.resize(static_cast<int>(chunkSize));
+  while (!m_cancelled)
+  {
+    const qint64 count = source.read(buffer.data(), chunkSize);
+    if (count == 0)
+      return true;
+    if (count < 0 || destination.write(buffer.constData(), count) != count)
+      return false;
+
+    copied += count;
+    m_bytesCopied += count;
+  }
+  return false;
+}
+
+void DirectoryCopier::fail(const QString& errorMessage)
+{
+  QMutexLocker locker(&m_errorMutex);
+  if (m_failed)
+    return;
+
+  m_failed = true;
+  m_errorMessage = errorMessage;
+}
+
+void DirectoryCopier::reportProgress()
+{
+  const qint64 elapsedMs = m_clock.elapsed();
+  const qint64 bytesCopied = m_bytesCopied;
+  const double bytesPerSecond = elapsedMs > 0 ? bytesCopied * 1000.0 / elapsedMs : 0.0;
+  emit progressChanged(bytesCopied, m_bytesTotal, bytesPerSecond);
+}
+
+void DirectoryCopier::complete()
+{
+  m_progressTimer->stop();
+  reportProgress();
+  m_running = false;
+
+  QString errorMessage;
+  {
+    QMutexLocker locker(&m_errorMutex);
+    errorMessage = m_errorMessage;
+  }
+  if (m_cancelled && errorMessage.isEmpty())
+    errorMessage = QStringLiteral("Copy cancelled");
+
+  emit finished(!m_failed && !m_cancelled, errorMessage, m_filesCopied, m_filesSkipped);
+}
@@ -0,0 +1,75 @@
+// [WriteFile Name=ApplyScheduledMapUpdates, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef DIRECTORYCOPIER_H
+#define DIRECTORYCOPIER_H
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+
+#include <atomic>
+
+class QTimer;
+
+// Mirrors a directory tree to a destination on a pool of worker threads.
+// Files whose size and modification time already match are skipped, files are
+// cloned or copied in the kernel where the platform supports it, and
+// destination entries that no longer exist in the source are removed.
+class DirectoryCopier : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit DirectoryCopier(QObject* parent = nullptr);
+  ~DirectoryCopier() override;
+
+  void start(const QString& sourcePath, const QString& destinationPath);
+  void cancel();
+  bool isRunning() const;
+  void setMaxThreadCount(int threadCount);
+
+signals:
+  void progressChanged(qint64 bytesCopied, qint64 bytesTotal, double bytesPerSecond);
+  void finished(bool success, const QString& errorMessage, int filesCopied, int filesSkipped);
+
+private:
+  void plan(const QString& sourcePath, const QString& destinationPath);
+  bool mirrorDirectory(const QString& sourcePath, const QString& destinationPath);
+  void copyFile(const QString& sourcePath, const QString& destinationPath, qint64 size);
+  bool copyFileContents(const QString& sourcePath, const QString& destinationPath, qint64& copied);
+  void fail(const QString& errorMessage);
+  void reportProgress();
+  void complete();
+
+  QThreadPool m_pool;
+  QTimer* m_progressTimer = nullptr;
+  QElapsedTimer m_clock;
+  bool m_running = false;
+  std::atomic_bool m_cancelled{false};
+  std::atomic_bool m_failed{false};
+  std::atomic<int> m_pendingFiles{0};
+  std::atomic<int> m_filesCopied{0};
+  std::atomic<int> m_filesSkipped{0};
+  std::atomic<qint64> m_bytesTotal{0};
+  std::atomic<qint64> m_bytesCopied{0};
+  QMutex m_errorMutex;
+  QString m_errorMessage;
+};
+
+#endif // DIRECTORYCOPIER_H
@@ -24,19 +24,50 @@
 #include "MapQuickView.h"
 #include "NmeaLocationDataSource.h"
 
-#include <QFile>
-#include <QTimer>
+#include <QDebug>
+#include <QThread>
 
 using namespace Esri::ArcGISRuntime;
 
 DisplayDeviceLocationWithNmeaDataSources::DisplayDeviceLocationWithNmeaDataSources(QObject* parent /* = nullptr */):
   QObject(parent),
   m_map(new Map(BasemapStyle::ArcGISNavigation, this)),
-  m_timer(new QTimer(this))
+  m_readerThread(new QThread(this)),
+  m_nmeaReader(new NmeaStreamReader())
 {
+  // Reading, validating and grouping the NMEA sentences happens on a worker thread,
+  // only complete blocks of sentences are delivered to the UI thread
+  m_nmeaReader->moveToThread(m_readerThread);
+  connect(m_readerThread, &QThread::finished, m_nmeaReader, &QObject::deleteLater);
+
+  connect(m_nmeaReader, &NmeaStreamReader::epochReady, this, [this](const QByteArray& epoch)
+  {
+    // Sentences pass information such as direction, velocity, and location and are grouped together to provide detailed information about a user's position
+    if (m_nmeaLocationDataSource)
+      m_nmeaLocationDataSource->pushData(epoch);
+  });
+
+  connect(m_nmeaReader, &NmeaStreamReader::statisticsChanged, this, [this](const NmeaStreamReader::Statistics& statistics)
+  {
+    m_statistics = statistics;
+    emit statisticsChanged();
+  });
+
+  connect(m_nmeaReader, &NmeaStreamReader::errorOccurred, this, [this](const QString& message)
+  {
+    qDebug() << message;
+    m_nmeaSimulationActive = false;
+    emit nmeaSimulationActiveChanged();
+  });
+
+  m_readerThread->start();
 }
 
-DisplayDeviceLocationWithNmeaDataSources::~DisplayDeviceLocationWithNmeaDataSources() = default;
+DisplayDeviceLocationWithNmeaDataSources::~DisplayDeviceLocationWithNmeaDataSources()
+{
+  m_readerThread->quit();
+  m_readerThread->wait();
+}
 
 void DisplayDeviceLocationWithNmeaDataSources::init()
 {
@@ -69,84 +100,95 @@ void DisplayDeviceLocationWithNmeaDataSources::setMapView(MapQuickView* mapView)
   emit mapViewChanged();
 }
 
-void DisplayDeviceLocationWithNmeaDataSources::start()
+void DisplayDeviceLocationWithNmeaDataSources::startLocationDisplay()
 {
   // Enable receiving NMEA location data from external device
   m_nmeaLocationDataSource->start();
 
   // Display the user's location
   m_mapView->locationDisplay()->start();
+}
 
-  // Load simulated NMEA sentences for sample
-  if (m_mockNmeaSentences.isEmpty())
-  {
-    const QString filePath = ":/Samples/Maps/DisplayDeviceLocationWithNmeaDataSources/redlands.nmea";
-    if(!loadMockDataFile(filePath))
-    {
-      qDebug() << "Unable to load file at path:" << filePath;
-      m_nmeaSimulationActive = false;
-      emit nmeaSimulationActiveChanged();
-
-      return;
-    }
-  }
+void DisplayDeviceLocationWithNmeaDataSources::start()
+{
+  startLocationDisplay();
 
-  // Simulate pushing data to the NMEA location data source
-  connect(m_timer, &QTimer::timeout, this, [this]()
-  {
-    const QByteArray line = m_mockNmeaSentences.at(m_mockDataIterator);
+  // Simulate pushing data to the NMEA location data source by replaying a log file.
+  // The sentences are paced by their timestamps, scaled by the replay rate.
+  const QString filePath = ":/Samples/Maps/DisplayDeviceLocationWithNmeaDataSources/redlands.nmea";
+  QMetaObject::invokeMethod(m_nmeaReader, "openFile", Qt::QueuedConnection,
+                            Q_ARG(QString, filePath), Q_ARG(double, m_replayRate));
+}
 
-    // In a non-simulated scenario, incoming NMEA sentences from a serial port or bluetooth device would be pushed to the location data source in real time
-    // NMEA sentences can be pushed individually or in multiple lines separated by line breaks
-    // Sentences pass information such as direction, velocity, and location and are grouped together to provide detailed information about a user's position
-    m_nmeaLocationDataSource->pushData(line);
+void DisplayDeviceLocationWithNmeaDataSources::startFromHost(const QString& hostName, int port)
+{
+  if (hostName.isEmpty() || port <= 0 || port > 65535)
+  {
+    qDebug() << "Invalid host or port:" << hostName << port;
+    m_nmeaSimulationActive = false;
+    emit nmeaSimulationActiveChanged();
+    return;
+  }
 
-    ++m_mockDataIterator;
-    if (m_mockDataIterator >= m_mockNmeaSentences.size())
-      m_mockDataIterator = 0;
-  });
+  startLocationDisplay();
 
-  m_mockDataIterator = 0;
-  m_timer->start(1000);
+  // In a non-simulated scenario, incoming NMEA sentences from a receiver are pushed to the location data source in real time.
+  // A serial port or pseudo-terminal can be bridged to a local TCP port, e.g. with socat.
+  QMetaObject::invokeMethod(m_nmeaReader, "connectToHost", Qt::QueuedConnection,
+                            Q_ARG(QString, hostName), Q_ARG(quint16, static_cast<quint16>(port)));
 }
 
 void DisplayDeviceLocationWithNmeaDataSources::reset()
 {
   // Disable simulated data
-  m_timer->stop();
-  disconnect(m_timer, &QTimer::timeout, nullptr, nullptr);
+  QMetaObject::invokeMethod(m_nmeaReader, "stop", Qt::QueuedConnection);
 
   // Stop displaying user's location
   m_mapView->locationDisplay()->stop();
 
   // Stop receiving location data
   m_nmeaLocationDataSource->stop();
+
+  m_statistics = NmeaStreamReader::Statistics();
+  emit statisticsChanged();
 }
 
-bool DisplayDeviceLocationWithNmeaDataSources::loadMockDataFile(const QString& filePath)
+double DisplayDeviceLocationWithNmeaDataSources::replayRate() const
 {
+  return m_replayRate;
+}
 
-  // Load simulated NMEA sentences to display for sample
-  QFile mockDataFile(filePath);
-
-  if(!mockDataFile.exists())
-    return false;
+void DisplayDeviceLocationWithNmeaDataSources::setReplayRate(double replayRate)
+{
+  if (replayRate <= 0.0 || qFuzzyCompare(replayRate, m_replayRate))
+    return;
 
-  mockDataFile.open(QIODevice::ReadOnly);
+  m_replayRate = replayRate;
+  QMetaObject::invokeMethod(m_nmeaReader, "setReplayRate", Qt::QueuedConnection, Q_ARG(double, m_replayRate));
+  emit replayRateChanged();
+}
 
-  while (!mockDataFile.atEnd()) {
-    QByteArray line = mockDataFile.readLine();
+double DisplayDeviceLocationWithNmeaDataSources::sentencesPerSecond() const
+{
+  return m_statistics.sentencesPerSecond;
+}
 
-    // In this simulated data stream, blocks of NMEA sentences start with $GPGGA (which provides the device's position)
-    if (line.startsWith("$GPGGA"))
-      m_mockNmeaSentences.append(line);
+qint64 DisplayDeviceLocationWithNmeaDataSources::receivedSentences() const
+{
+  return m_statistics.sentences;
+}
 
-    // Additional sentences that provide information such as direction and velocity follow and are separated by line breaks
-    else
-      m_mockNmeaSentences.last() += line;
-  }
+qint64 DisplayDeviceLocationWithNmeaDataSources::droppedSentences() const
+{
+  return m_statistics.droppedSentences;
+}
 
-  mockDataFile.close();
-  return true;
+qint64 DisplayDeviceLocationWithNmeaDataSources::checksumErrors() const
+{
+  return m_statistics.checksumErrors;
 }
 
+qint64 DisplayDeviceLocationWithNmeaDataSources::malformedSentences() const
+{
+  return m_statistics.malformedSentences;
+}
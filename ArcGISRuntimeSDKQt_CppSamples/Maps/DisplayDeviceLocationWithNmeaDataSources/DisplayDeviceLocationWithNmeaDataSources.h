@@ -27,10 +27,12 @@ class NmeaLocationDataSource;
 }
 }
 
+#include "NmeaStreamReader.h"
+
 #include <QObject>
 #include <QByteArray>
-#include <QFile>
-#include <QTimer>
+
+class QThread;
 
 class DisplayDeviceLocationWithNmeaDataSources : public QObject
 {
@@ -38,6 +40,12 @@ class DisplayDeviceLocationWithNmeaDataSources : public QObject
 
   Q_PROPERTY(Esri::ArcGISRuntime::MapQuickView* mapView READ mapView WRITE setMapView NOTIFY mapViewChanged)
   Q_PROPERTY(bool nmeaSimulationActive MEMBER m_nmeaSimulationActive NOTIFY nmeaSimulationActiveChanged)
+  Q_PROPERTY(double replayRate READ replayRate WRITE setReplayRate NOTIFY replayRateChanged)
+  Q_PROPERTY(double sentencesPerSecond READ sentencesPerSecond NOTIFY statisticsChanged)
+  Q_PROPERTY(qint64 receivedSentences READ receivedSentences NOTIFY statisticsChanged)
+  Q_PROPERTY(qint64 droppedSentences READ droppedSentences NOTIFY statisticsChanged)
+  Q_PROPERTY(qint64 checksumErrors READ checksumErrors NOTIFY statisticsChanged)
+  Q_PROPERTY(qint64 malformedSentences READ malformedSentences NOTIFY statisticsChanged)
 
 public:
   explicit DisplayDeviceLocationWithNmeaDataSources(QObject* parent = nullptr);
@@ -47,22 +55,33 @@ public:
 
   Q_INVOKABLE void start();
   Q_INVOKABLE void reset();
+  Q_INVOKABLE void startFromHost(const QString& hostName, int port);
 
 signals:
   void mapViewChanged();
   void nmeaSimulationActiveChanged();
+  void replayRateChanged();
+  void statisticsChanged();
 
 private:
   Esri::ArcGISRuntime::MapQuickView* mapView() const;
   void setMapView(Esri::ArcGISRuntime::MapQuickView* mapView);
-  bool loadMockDataFile(const QString& filePath);
+  void startLocationDisplay();
+  double replayRate() const;
+  void setReplayRate(double replayRate);
+  double sentencesPerSecond() const;
+  qint64 receivedSentences() const;
+  qint64 droppedSentences() const;
+  qint64 checksumErrors() const;
+  qint64 malformedSentences() const;
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   Esri::ArcGISRuntime::NmeaLocationDataSource* m_nmeaLocationDataSource = nullptr;
-  QList<QByteArray> m_mockNmeaSentences;
-  int m_mockDataIterator;
-  QTimer* m_timer = nullptr;
+  QThread* m_readerThread = nullptr;
+  NmeaStreamReader* m_nmeaReader = nullptr;
+  NmeaStreamReader::Statistics m_statistics;
+  double m_replayRate = 1.0;
   bool m_nmeaSimulationActive = false;
 };
 
@@ -19,6 +19,7 @@ import QtQuick.Controls 2.2
 import Esri.Samples 1.0
 
 Item {
+    property bool streamingFromHost: false
 
     // add a mapView component
     MapView {
@@ -32,6 +33,101 @@ Item {
         mapView: view
     }
 
+    Rectangle {
+        anchors {
+            left: parent.left
+            top: parent.top
+            margins: 5
+        }
+        width: statisticsColumn.width + 10
+        height: statisticsColumn.height + 10
+        color: "white"
+        opacity: 0.8
+        visible: model.nmeaSimulationActive
+
+        Column {
+            id: statisticsColumn
+            anchors.centerIn: parent
+
+            Text {
+                text: "Sentences/s: " + model.sentencesPerSecond.toFixed(1)
+            }
+
+            Text {
+                text: "Received: " + model.receivedSentences + "  Dropped: " + model.droppedSentences
+            }
+
+            Text {
+                text: "Checksum errors: " + model.checksumErrors + "  Malformed: " + model.malformedSentences
+            }
+
+            Row {
+                spacing: 5
+
+                Text {
+                    anchors.verticalCenter: parent.verticalCenter
+                    text: "Replay rate: " + model.replayRate + "x"
+                }
+
+                Slider {
+                    enabled: !streamingFromHost
+                    from: 1
+                    to: 20
+                    stepSize: 1
+                    value: model.replayRate
+                    onMoved: model.replayRate = value
+                }
+            }
+        }
+    }
+
+    // read live sentences from a receiver bridged to a TCP port instead of the log file
+    Rectangle {
+        anchors {
+            horizontalCenter: parent.horizontalCenter
+            bottom: button.top
+            margins: 10
+        }
+        width: hostRow.width + 10
+        height: hostRow.height + 10
+        color: "white"
+        opacity: 0.8
+        visible: !model.nmeaSimulationActive
+
+        Row {
+            id: hostRow
+            anchors.centerIn: parent
+            spacing: 5
+
+            TextField {
+                id: hostField
+                width: 150
+                placeholderText: "Host"
+                text: "localhost"
+                selectByMouse: true
+            }
+
+            TextField {
+                id: portField
+                width: 70
+                placeholderText: "Port"
+                text: "10110"
+                selectByMouse: true
+                validator: IntValidator { bottom: 1; top: 65535 }
+            }
+
+            Button {
+                text: "CONNECT"
+                enabled: hostField.text.length > 0 && portField.acceptableInput
+                onClicked: {
+                    streamingFromHost = true;
+                    model.nmeaSimulationActive = true;
+                    model.startFromHost(hostField.text, parseInt(portField.text));
+                }
+            }
+        }
+    }
+
     Button {
         id: button
         anchors {
@@ -43,6 +139,7 @@ Item {
         text: model.nmeaSimulationActive ? "RESET" : "START"
         onClicked: {
             model.nmeaSimulationActive = !model.nmeaSimulationActive;
+            streamingFromHost = false;
             if (model.nmeaSimulationActive)
                 model.start();
             else
@@ -0,0 +1,396 @@
+// [WriteFile Name=DisplayDeviceLocationWithNmeaDataSources, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "NmeaStreamReader.h"
+
+#include <QFile>
+#include <QTcpSocket>
+#include <QTimer>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+constexpr int statisticsIntervalMs = 1000;
+constexpr double secondsPerDay = 86400.0;
+
+// blocks of sentences start with a GGA sentence (which provides the device's
+// position) regardless of the talker, e.g. $GPGGA or $GNGGA
+bool isEpochStart(const QByteArray& sentence)
+{
+  return sentence.size() > 6 && sentence.mid(3, 3) == "GGA";
+}
+
+// a GGA sentence has 14 data fields after the address field
+constexpr int ggaFieldCount = 15;
+
+// the address field is a two character talker and a three character sentence
+// type, or a proprietary sentence starting with P
+bool hasValidAddress(const QByteArray& sentence)
+{
+  const int comma = sentence.indexOf(',');
+  const int asterisk = sentence.lastIndexOf('*');
+  const int end = comma < 0 ? asterisk : comma;
+  if (end < 2)
+    return false;
+
+  if (sentence.at(1) != 'P' && end != 6)
+    return false;
+
+  for (int i = 1; i < end; ++i)
+  {
+    const char c = sentence.at(i);
+    if (!((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')))
+      return false;
+  }
+
+  return true;
+}
+
+// returns the UTC time of a GGA sentence in seconds since midnight, or -1
+double epochTime(const QByteArray& ggaSentence)
+{
+  const QList<QByteArray> fields = ggaSentence.split(',');
+  if (fields.size() < 2 || fields.at(1).size() < 6)
+    return -1.0;
+
+  const QByteArray& time = fields.at(1);
+  bool hoursOk = false;
+  bool minutesOk = false;
+  bool secondsOk = false;
+  const int hours = time.left(2).toInt(&hoursOk);
+  const int minutes = time.mid(2, 2).toInt(&minutesOk);
+  const double seconds = time.mid(4).toDouble(&secondsOk);
+  if (!hoursOk || !minutesOk || !secondsOk)
+    return -1.0;
+
+  return hours * 3600.0 + minutes * 60.0 + seconds;
+}
+} // namespace
+
+NmeaStreamReader::NmeaStreamReader(QObject* parent /* = nullptr */):
+  QObject(parent),
+  m_replayTimer(new QTimer(this)),
+  m_statisticsTimer(new QTimer(this))
+{
+  qRegisterMetaType<NmeaStreamReader::Statistics>();
+
+  // the timers are children of the reader, so they follow it to the worker thread
+  m_replayTimer->setSingleShot(true);
+  m_replayTimer->setTimerType(Qt::PreciseTimer);
+  connect(m_replayTimer, &QTimer::timeout, this, &NmeaStreamReader::emitPendingEpoch);
+
+  m_statisticsTimer->setInterval(statisticsIntervalMs);
+  connect(m_statisticsTimer, &QTimer::timeout, this, &NmeaStreamReader::reportStatistics);
+}
+
+NmeaStreamReader::~NmeaStreamReader() = default;
+
+NmeaStreamReader::SentenceStatus NmeaStreamReader::validateSentence(const QByteArray& sentence)
+{
+  // a sentence looks like $GPGGA,...*4D where 4D is the XOR of every
+  // character between the $ and the *
+  const int asterisk = sentence.lastIndexOf('*');
+  if (sentence.size() < 4 || (sentence.at(0) != '$' && sentence.at(0) != '!') ||
+      asterisk < 1 || asterisk + 3 != sentence.size())
+  {
+    return SentenceStatus::Malformed;
+  }
+
+  quint8 checksum = 0;
+  for (int i = 1; i < asterisk; ++i)
+    checksum ^= static_cast<quint8>(sentence.at(i));
+
+  bool ok = false;
+  const uint expected = sentence.mid(asterisk + 1, 2).toUInt(&ok, 16);
+  if (!ok)
+    return SentenceStatus::Malformed;
+
+  if (expected != checksum)
+    return SentenceStatus::ChecksumMismatch;
+
+  // the checksum matches, but the location data source cannot use a sentence
+  // without a valid address or a GGA sentence that is missing fields
+  if (!hasValidAddress(sentence) || (isEpochStart(sentence) && sentence.count(',') + 1 < ggaFieldCount))
+    return SentenceStatus::Malformed;
+
+  return SentenceStatus::Valid;
+}
+
+void NmeaStreamReader::openFile(const QString& filePath, double replayRate)
+{
+  stop();
+
+  m_file = new QFile(filePath, this);
+  if (!m_file->open(QIODevice::ReadOnly))
+  {
+    emit errorOccurred(QString("Unable to open file at path: %1").arg(filePath));
+    stop();
+    return;
+  }
+
+  m_replayRate = replayRate > 0.0 ? replayRate : 1.0;
+  m_statisticsClock.start();
+  m_statisticsTimer->start();
+  scheduleNextEpoch();
+}
+
+void NmeaStreamReader::connectToHost(const QString& hostName, quint16 port)
+{
+  stop();
+
+  m_socket = new QTcpSocket(this);
+  connect(m_socket, &QTcpSocket::readyRead, this, &NmeaStreamReader::readSocket);
+  connect(m_socket, &QTcpSocket::errorOccurred, this, [this]()
+  {
+    emit errorOccurred(m_socket->errorString());
+  });
+
+  m_socket->connectToHost(hostName, port);
+  m_statisticsClock.start();
+  m_statisticsTimer->start();
+}
+
+void NmeaStreamReader::setReplayRate(double replayRate)
+{
+  if (replayRate <= 0.0)
+    return;
+
+  m_replayRate = replayRate;
+  if (!m_file || !m_replayTimer->isActive())
+    return;
+
+  // re-base the replay clock on the last epoch that was actually delivered so
+  // that the new rate only applies from now on and the pending epoch is not
+  // released early; before the first delivery the pending epoch is the anchor
+  m_replayStartTime = m_emittedEpochTime >= 0.0 ? m_emittedEpochTime : m_pendingEpochTime;
+  m_replayClock.restart();
+  startReplayTimer();
+}
+
+void NmeaStreamReader::stop()
+{
+  m_replayTimer->stop();
+  m_statisticsTimer->stop();
+
+  delete m_file;
+  m_file = nullptr;
+  delete m_socket;
+  m_socket = nullptr;
+
+  m_epoch.clear();
+  m_pendingLine.clear();
+  m_pendingEpoch.clear();
+  m_replayStartTime = -1.0;
+  m_lastEpochTime = -1.0;
+  m_pendingEpochTime = -1.0;
+  m_emittedEpochTime = -1.0;
+  m_dayOffset = 0.0;
+  m_statistics = Statistics();
+  m_sentencesAtLastReport = 0;
+}
+
+void NmeaStreamReader::readSocket()
+{
+  while (m_socket && m_socket->canReadLine())
+    processLine(m_socket->readLine());
+}
+
+// counts a sentence and returns whether it can be passed on; invalid sentences are dropped
+bool NmeaStreamReader::acceptSentence(const QByteArray& sentence)
+{
+  ++m_statistics.sentences;
+  switch (validateSentence(sentence))
+  {
+  case SentenceStatus::Valid:
+    return true;
+  case SentenceStatus::ChecksumMismatch:
+    ++m_statistics.checksumErrors;
+    break;
+  case SentenceStatus::Malformed:
+    ++m_statistics.malformedSentences;
+    break;
+  }
+
+  ++m_statistics.droppedSentences;
+  return false;
+}
+
+void NmeaStreamReader::processLine(const QByteArray& line)
+{
+  const QByteArray sentence = line.trimmed();
+  if (sentence.isEmpty())
+    return;
+
+  if (!acceptSentence(sentence))
+    return;
+
+  if (isEpochStart(sentence))
+  {
+    flushEpoch();
+  }
+  else if (m_epoch.isEmpty())
+  {
+    // sentences received before the first GGA cannot be grouped
+    ++m_statistics.droppedSentences;
+    return;
+  }
+
+  m_epoch += sentence;
+  m_epoch += '\n';
+}
+
+void NmeaStreamReader::flushEpoch()
+{
+  if (m_epoch.isEmpty())
+    return;
+
+  ++m_statistics.epochs;
+  emit epochReady(m_epoch);
+  m_epoch.clear();
+}
+
+bool NmeaStreamReader::readEpochFromFile(QByteArray& epoch, double& time)
+{
+  epoch.clear();
+  time = -1.0;
+
+  // the GGA sentence that ended the previous epoch starts this one
+  if (!m_pendingLine.isEmpty())
+  {
+    epoch = m_pendingLine;
+    time = epochTime(m_pendingLine);
+    m_pendingLine.clear();
+  }
+
+  while (!m_file->atEnd())
+  {
+    const QByteArray sentence = m_file->readLine().trimmed();
+    if (sentence.isEmpty())
+      continue;
+
+    if (!acceptSentence(sentence))
+      continue;
+
+    if (isEpochStart(sentence))
+    {
+      if (!epoch.isEmpty())
+      {
+        m_pendingLine = sentence + '\n';
+        return true;
+      }
+
+      time = epochTime(sentence);
+    }
+    else if (epoch.isEmpty())
+    {
+      ++m_statistics.droppedSentences;
+      continue;
+    }
+
+    epoch += sentence;
+    epoch += '\n';
+  }
+
+  return !epoch.isEmpty();
+}
+
+void NmeaStreamReader::scheduleNextEpoch()
+{
+  if (!m_file)
+    return;
+
+  double time = -1.0;
+  if (!readEpochFromFile(m_pendingEpoch, time))
+  {
+    // replay the log from the start once the end has been reached
+    m_file->seek(0);
+    m_pendingLine.clear();
+    m_replayStartTime = -1.0;
+    m_lastEpochTime = -1.0;
+    m_emittedEpochTime = -1.0;
+    m_dayOffset = 0.0;
+
+    if (!readEpochFromFile(m_pendingEpoch, time))
+    {
+      emit errorOccurred(QString("No NMEA epochs found in %1").arg(m_file->fileName()));
+      stop();
+      return;
+    }
+  }
+
+  // epochs without a usable timestamp are paced one second after the previous one
+  if (time < 0.0)
+  {
+    time = m_lastEpochTime < 0.0 ? 0.0 : m_lastEpochTime + 1.0;
+  }
+  else
+  {
+    time += m_dayOffset;
+    if (m_lastEpochTime >= 0.0 && time < m_lastEpochTime - secondsPerDay / 2.0)
+    {
+      // the log crossed midnight UTC
+      m_dayOffset += secondsPerDay;
+      time += secondsPerDay;
+    }
+  }
+
+  if (m_replayStartTime < 0.0)
+  {
+    m_replayStartTime = time;
+    m_replayClock.start();
+  }
+
+  m_lastEpochTime = time;
+  m_pendingEpochTime = time;
+  startReplayTimer();
+}
+
+void NmeaStreamReader::startReplayTimer()
+{
+  // when replay falls behind the epoch is delivered immediately
+  const double dueMs = (m_pendingEpochTime - m_replayStartTime) * 1000.0 / m_replayRate;
+  const qint64 delayMs = static_cast<qint64>(std::ceil(dueMs)) - m_replayClock.elapsed();
+  m_replayTimer->start(static_cast<int>(std::max<qint64>(0, delayMs)));
+}
+
+void NmeaStreamReader::emitPendingEpoch()
+{
+  if (!m_pendingEpoch.isEmpty())
+  {
+    ++m_statistics.epochs;
+    emit epochReady(m_pendingEpoch);
+    m_pendingEpoch.clear();
+    m_emittedEpochTime = m_pendingEpochTime;
+  }
+
+  scheduleNextEpoch();
+}
+
+void NmeaStreamReader::reportStatistics()
+{
+  const qint64 elapsedMs = m_statisticsClock.restart();
+  if (elapsedMs > 0)
+    m_statistics.sentencesPerSecond = (m_statistics.sentences - m_sentencesAtLastReport) * 1000.0 / elapsedMs;
+
+  m_sentencesAtLastReport = m_statistics.sentences;
+  emit statisticsChanged(m_statistics);
+}
@@ -0,0 +1,105 @@
+// [WriteFile Name=DisplayDeviceLocationWithNmeaDataSources, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef NMEASTREAMREADER_H
+#define NMEASTREAMREADER_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QObject>
+
+class QFile;
+class QTcpSocket;
+class QTimer;
+
+// Reads NMEA sentences from a log file or a TCP socket and groups them into
+// epochs, each starting with a GGA sentence. The reader is intended to be moved
+// to a worker thread; its slots must be invoked through queued connections and
+// completed epochs are delivered through the epochReady signal.
+class NmeaStreamReader : public QObject
+{
+  Q_OBJECT
+
+public:
+  struct Statistics
+  {
+    qint64 sentences = 0;
+    qint64 epochs = 0;
+    qint64 checksumErrors = 0;
+    qint64 malformedSentences = 0;
+    qint64 droppedSentences = 0;
+    double sentencesPerSecond = 0.0;
+  };
+
+  explicit NmeaStreamReader(QObject* parent = nullptr);
+  ~NmeaStreamReader() override;
+
+  enum class SentenceStatus
+  {
+    Valid,
+    Malformed,
+    ChecksumMismatch
+  };
+
+  static SentenceStatus validateSentence(const QByteArray& sentence);
+
+public slots:
+  // replays a log file, pacing the epochs by their GGA timestamps divided
+  // by the replay rate. The file is read incrementally and replayed in a loop.
+  void openFile(const QString& filePath, double replayRate);
+  // reads a live stream, e.g. a receiver bridged from a serial port to TCP
+  void connectToHost(const QString& hostName, quint16 port);
+  void setReplayRate(double replayRate);
+  void stop();
+
+signals:
+  void epochReady(const QByteArray& epoch);
+  void statisticsChanged(const NmeaStreamReader::Statistics& statistics);
+  void errorOccurred(const QString& message);
+
+private:
+  void readSocket();
+  bool acceptSentence(const QByteArray& sentence);
+  void scheduleNextEpoch();
+  void emitPendingEpoch();
+  void startReplayTimer();
+  bool readEpochFromFile(QByteArray& epoch, double& epochTime);
+  void processLine(const QByteArray& line);
+  void flushEpoch();
+  void reportStatistics();
+
+  QFile* m_file = nullptr;
+  QTcpSocket* m_socket = nullptr;
+  QTimer* m_replayTimer = nullptr;
+  QTimer* m_statisticsTimer = nullptr;
+  QByteArray m_epoch;
+  QByteArray m_pendingLine;
+  QByteArray m_pendingEpoch;
+  QElapsedTimer m_replayClock;
+  QElapsedTimer m_statisticsClock;
+  double m_replayRate = 1.0;
+  double m_replayStartTime = -1.0;
+  double m_lastEpochTime = -1.0;
+  double m_pendingEpochTime = -1.0;
+  double m_emittedEpochTime = -1.0;
+  double m_dayOffset = 0.0;
+  Statistics m_statistics;
+  qint64 m_sentencesAtLastReport = 0;
+};
+
+Q_DECLARE_METATYPE(NmeaStreamReader::Statistics)
+
+#endif // NMEASTREAMREADER_H
@@ -22,7 +22,7 @@ mac {
 CONFIG += c++14
 
 # additional modules are pulled in via arcgisruntime.pri
-QT += opengl qml quick
+QT += opengl qml quick network
 
 TEMPLATE = app
 TARGET = DisplayDeviceLocationWithNmeaDataSources
@@ -33,11 +33,13 @@ include($$PWD/arcgisruntime.pri)
 #-------------------------------------------------------------------------------
 
 HEADERS += \
-    DisplayDeviceLocationWithNmeaDataSources.h
+    DisplayDeviceLocationWithNmeaDataSources.h \
+    NmeaStreamReader.h
 
 SOURCES += \
     main.cpp \
-    DisplayDeviceLocationWithNmeaDataSources.cpp
+    DisplayDeviceLocationWithNmeaDataSources.cpp \
+    NmeaStreamReader.cpp
 
 RESOURCES += DisplayDeviceLocationWithNmeaDataSources.qrc
 
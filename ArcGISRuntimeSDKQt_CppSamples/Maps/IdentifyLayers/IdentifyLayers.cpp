@@ -31,8 +31,16 @@
 #include "Point.h"
 #include "IdentifyLayerResult.h"
 
+#include <algorithm>
+
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+// total number of GeoElements counted across all layers for one identify
+constexpr int maxCountedResults = 100;
+}
+
 IdentifyLayers::IdentifyLayers(QQuickItem* parent /* = nullptr */):
   QQuickItem(parent)
 {
@@ -110,53 +118,66 @@ void IdentifyLayers::connectSignals()
   {
     // reset the message text
     m_message = QString();
-    int i = 0;
+    int remainingBudget = maxCountedResults;
+    bool stoppedEarly = false;
 
-    for (IdentifyLayerResult* result : results)
+    for (int i = 0; i < results.length(); ++i)
     {
-      ++i;
-      // lambda for calculating result count
-      auto geoElementsCountFromResult = [] (IdentifyLayerResult* result) -> int
-      {
-        // create temp list
-        QList<IdentifyLayerResult*> tempResults{result};
-
-        // use Depth First Search approach to handle recursion
-        int count = 0;
-        int index = 0;
-
-        while (index < tempResults.length())
-        {
-          //get the result object from the array
-          IdentifyLayerResult* identifyResult = tempResults[index];
-
-          // update count with geoElements from the result
-          count += identifyResult->geoElements().length();
-
-          // check if the result has any sublayer results
-          // if yes then add those result objects in the tempResults
-          // array after the current result
-          if (identifyResult->sublayerResults().length() > 0)
-          {
-            tempResults.append(identifyResult->sublayerResults().at(index));
-          }
-
-          // update the count and repeat
-          index += 1;
-        }
-        return count;
-      };
-
-      const int count = geoElementsCountFromResult(result);
+      IdentifyLayerResult* result = results.at(i);
       QString layerName = result->layerContent()->name();
-      m_message += QString("%1 : %2").arg(layerName).arg(count);
+
+      // each count includes the sublayer results, so it is never 0 for a
+      // matching layer; layers left once the budget is spent are "not counted"
+      if (remainingBudget <= 0)
+      {
+        stoppedEarly = true;
+        m_message += QString("%1 : not counted").arg(layerName);
+      }
+      else
+      {
+        // count the result and all of its sublayer results
+        const int count = countGeoElements(result, remainingBudget, stoppedEarly);
+        remainingBudget -= count;
+
+        m_message += QString("%1 : %2").arg(layerName).arg(count);
+      }
       // add new line character if not the final element inthe array
-      if (i != results.length())
+      if (i != results.length() - 1)
         m_message += "\n";
     }
 
+    if (stoppedEarly)
+      m_message += QString("\n(counting stopped after %1 results)").arg(maxCountedResults);
+
     emit messageChanged();
     emit showMessage();
     qDeleteAll(results);
   });
 }
+
+// Counts the GeoElements of a result and of its sublayer results, breadth
+// first, visiting each result once. Counting stops once the budget is met.
+int IdentifyLayers::countGeoElements(IdentifyLayerResult* result, int budget, bool& stoppedEarly)
+{
+  m_traversalQueue.clear();
+  m_traversalQueue.push_back(result);
+
+  int count = 0;
+  std::size_t head = 0;
+  for (; head < m_traversalQueue.size() && count < budget; ++head)
+  {
+    IdentifyLayerResult* identifyResult = m_traversalQueue[head];
+
+    // update count with geoElements from the result
+    count += identifyResult->geoElements().length();
+
+    // queue the sublayer results after the results already waiting
+    const QList<IdentifyLayerResult*> sublayerResults = identifyResult->sublayerResults();
+    m_traversalQueue.insert(m_traversalQueue.end(), sublayerResults.cbegin(), sublayerResults.cend());
+  }
+
+  if (count > budget || head < m_traversalQueue.size())
+    stoppedEarly = true;
+
+  return std::min(count, budget);
+}
@@ -21,6 +21,7 @@ namespace Esri
 {
 namespace ArcGISRuntime
 {
+class IdentifyLayerResult;
 class Map;
 class MapQuickView;
 }
@@ -28,6 +29,8 @@ class MapQuickView;
 
 #include <QQuickItem>
 
+#include <vector>
+
 class IdentifyLayers : public QQuickItem
 {
   Q_OBJECT
@@ -46,11 +49,14 @@ signals:
 
 private:
   void connectSignals();
+  int countGeoElements(Esri::ArcGISRuntime::IdentifyLayerResult* result, int budget, bool& stoppedEarly);
 
 private:
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   QString m_message;
+  // breadth first traversal buffer, reused between identify operations
+  std::vector<Esri::ArcGISRuntime::IdentifyLayerResult*> m_traversalQueue;
 };
 
 #endif // IDENTIFYLAYERS_H
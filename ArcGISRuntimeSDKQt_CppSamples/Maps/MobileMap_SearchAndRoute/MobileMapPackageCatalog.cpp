@@ -0,0 +1,216 @@
+// [WriteFile Name=MobileMap_SearchAndRoute, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "MobileMapPackageCatalog.h"
+
+#include "Envelope.h"
+#include "Item.h"
+#include "MobileMapPackage.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRunnable>
+#include <QStandardPaths>
+
+using namespace Esri::ArcGISRuntime;
+
+namespace
+{
+// packages that are opened at the same time to read their metadata
+constexpr int maxReadsInFlight = 4;
+
+QString catalogFileName()
+{
+  return QStringLiteral("catalog.json");
+}
+
+QJsonObject toJson(const MobileMapPackageCatalog::Entry& entry)
+{
+  QJsonObject object;
+  object["path"] = entry.path;
+  object["lastModified"] = entry.lastModified.toMSecsSinceEpoch();
+  object["title"] = entry.title;
+  object["extent"] = entry.extent;
+  object["thumbnailPath"] = entry.thumbnailPath;
+  return object;
+}
+
+MobileMapPackageCatalog::Entry fromJson(const QJsonObject& object)
+{
+  MobileMapPackageCatalog::Entry entry;
+  entry.path = object["path"].toString();
+  entry.lastModified = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(object["lastModified"].toDouble()));
+  entry.title = object["title"].toString();
+  entry.extent = object["extent"].toString();
+  entry.thumbnailPath = object["thumbnailPath"].toString();
+  return entry;
+}
+} // namespace
+
+MobileMapPackageCatalog::MobileMapPackageCatalog(QObject* parent /* = nullptr */):
+  QObject(parent)
+{
+}
+
+MobileMapPackageCatalog::~MobileMapPackageCatalog()
+{
+  m_pool.waitForDone();
+}
+
+// Lists the packages in dataPath. Entries for unchanged packages are reported
+// straight from the cache; the others are reported as their packages are read.
+void MobileMapPackageCatalog::scan(const QString& dataPath)
+{
+  m_scanTimer.start();
+  const QString cachePath = QDir(cacheDirectory()).filePath(catalogFileName());
+
+  // listing the directory and parsing the cache only touch the disk, so they run on the pool
+  m_pool.start(QRunnable::create([this, dataPath, cachePath]()
+  {
+    QHash<QString, Entry> cache;
+    QFile cacheFile(cachePath);
+    if (cacheFile.open(QIODevice::ReadOnly))
+    {
+      const QJsonArray cachedEntries = QJsonDocument::fromJson(cacheFile.readAll()).array();
+      for (const QJsonValue& value : cachedEntries)
+      {
+        const Entry entry = fromJson(value.toObject());
+        cache.insert(entry.path, entry);
+      }
+    }
+
+    QList<Entry> cachedEntries;
+    QStringList changedPaths;
+    const QFileInfoList files = QDir(dataPath).entryInfoList(QStringList{"*.mmpk"}, QDir::Files, QDir::Name);
+    for (const QFileInfo& file : files)
+    {
+      const QString path = file.absoluteFilePath();
+      auto it = cache.constFind(path);
+      if (it != cache.constEnd() && it->lastModified == file.lastModified())
+        cachedEntries.append(it.value());
+      else
+        changedPaths.append(path);
+    }
+
+    QMetaObject::invokeMethod(this, [this, cachedEntries, changedPaths]()
+    {
+      handleCachedEntries(cachedEntries, changedPaths);
+    }, Qt::QueuedConnection);
+  }));
+}
+
+void MobileMapPackageCatalog::handleCachedEntries(const QList<Entry>& cachedEntries, const QStringList& changedPaths)
+{
+  m_entries.clear();
+  m_cachedCount = cachedEntries.size();
+  m_readCount = 0;
+
+  for (const Entry& entry : cachedEntries)
+  {
+    m_entries.append(entry);
+    emit entryAdded(m_entries.size() - 1);
+  }
+
+  m_pathsToRead = changedPaths;
+  readNextPackages();
+}
+
+// Opens new or changed packages to read their metadata, a few at a time.
+void MobileMapPackageCatalog::readNextPackages()
+{
+  if (m_pathsToRead.isEmpty() && m_readsInFlight == 0)
+  {
+    saveCache();
+    emit scanCompleted(m_cachedCount, m_readCount, m_scanTimer.elapsed());
+    return;
+  }
+
+  while (m_readsInFlight < maxReadsInFlight && !m_pathsToRead.isEmpty())
+  {
+    const QString path = m_pathsToRead.takeFirst();
+    MobileMapPackage* mobileMapPackage = new MobileMapPackage(path, this);
+    ++m_readsInFlight;
+
+    connect(mobileMapPackage, &MobileMapPackage::doneLoading, this, [this, mobileMapPackage, path](Error error)
+    {
+      if (error.isEmpty())
+      {
+        Entry entry;
+        entry.path = path;
+        entry.lastModified = QFileInfo(path).lastModified();
+        entry.title = mobileMapPackage->item()->title();
+        entry.extent = mobileMapPackage->item()->extent().toJson();
+
+        const QImage thumbnail = mobileMapPackage->item()->thumbnail();
+        if (!thumbnail.isNull())
+        {
+          const QString name = QCryptographicHash::hash(path.toUtf8(), QCryptographicHash::Sha1).toHex();
+          entry.thumbnailPath = QDir(cacheDirectory()).filePath(name + ".png");
+          if (!thumbnail.save(entry.thumbnailPath))
+            entry.thumbnailPath.clear();
+        }
+
+        m_entries.append(entry);
+        ++m_readCount;
+        emit entryAdded(m_entries.size() - 1);
+      }
+
+      // the package is opened again only when it is selected
+      mobileMapPackage->deleteLater();
+      finishPackage();
+    });
+
+    mobileMapPackage->load();
+  }
+}
+
+void MobileMapPackageCatalog::finishPackage()
+{
+  --m_readsInFlight;
+  readNextPackages();
+}
+
+void MobileMapPackageCatalog::saveCache()
+{
+  // only newly read packages change the cache
+  if (m_readCount == 0)
+    return;
+
+  QJsonArray entries;
+  for (const Entry& entry : qAsConst(m_entries))
+    entries.append(toJson(entry));
+
+  QFile cacheFile(QDir(cacheDirectory()).filePath(catalogFileName()));
+  if (cacheFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    cacheFile.write(QJsonDocument(entries).toJson(QJsonDocument::Compact));
+}
+
+QString MobileMapPackageCatalog::cacheDirectory() const
+{
+  const QString path = QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)).filePath("MobileMap_SearchAndRoute");
+  QDir().mkpath(path);
+  return path;
+}
@@ -0,0 +1,74 @@
+// [WriteFile Name=MobileMap_SearchAndRoute, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef MOBILEMAPPACKAGECATALOG_H
+#define MOBILEMAPPACKAGECATALOG_H
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QStringList>
+#include <QThreadPool>
+
+// Lists the mobile map packages in a directory without keeping them loaded.
+// The title, extent and thumbnail of each package are cached on disk, keyed
+// by the package path and modification time, so packages that have not
+// changed are listed without being opened. Only new or changed packages are
+// loaded to read their metadata, a few at a time, and are released again.
+class MobileMapPackageCatalog : public QObject
+{
+  Q_OBJECT
+
+public:
+  struct Entry
+  {
+    QString path;
+    QDateTime lastModified;
+    QString title;
+    // JSON of the package item's extent
+    QString extent;
+    QString thumbnailPath;
+  };
+
+  explicit MobileMapPackageCatalog(QObject* parent = nullptr);
+  ~MobileMapPackageCatalog() override;
+
+  void scan(const QString& dataPath);
+  const QList<Entry>& entries() const { return m_entries; }
+
+signals:
+  void entryAdded(int index);
+  void scanCompleted(int cachedCount, int readCount, qint64 msecs);
+
+private:
+  void handleCachedEntries(const QList<Entry>& cachedEntries, const QStringList& changedPaths);
+  void readNextPackages();
+  void finishPackage();
+  void saveCache();
+  QString cacheDirectory() const;
+
+  QList<Entry> m_entries;
+  QStringList m_pathsToRead;
+  int m_readsInFlight = 0;
+  int m_cachedCount = 0;
+  int m_readCount = 0;
+  QElapsedTimer m_scanTimer;
+  QThreadPool m_pool;
+};
+
+#endif // MOBILEMAPPACKAGECATALOG_H
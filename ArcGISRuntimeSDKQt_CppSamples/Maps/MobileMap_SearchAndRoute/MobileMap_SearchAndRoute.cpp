@@ -36,9 +36,9 @@
 #include "MobileMapPackage.h"
 #include "PictureMarkerSymbol.h"
 #include "ReverseGeocodeParameters.h"
+#include "MobileMapPackageCatalog.h"
 
 #include <QDir>
-#include <QFileInfoList>
 #include <QFile>
 #include <QtCore/qglobal.h>
 
@@ -74,8 +74,9 @@ MobileMap_SearchAndRoute::MobileMap_SearchAndRoute(QQuickItem* parent):
   m_canClear(false),
   m_isGeocodeInProgress(false),
   m_dataPath(defaultDataPath() + "/ArcGIS/Runtime/Data/mmpk"),
-  m_fileInfoList(QDir(m_dataPath).entryInfoList())
+  m_catalog(new MobileMapPackageCatalog(this))
 {
+  m_startupTimer.start();
 }
 
 MobileMap_SearchAndRoute::~MobileMap_SearchAndRoute() = default;
@@ -101,8 +102,8 @@ void MobileMap_SearchAndRoute::componentComplete()
   // set reverse geocoding parameters
   m_reverseGeocodeParameters.setMaxResults(1);
 
-  // identify and create MobileMapPackages using mmpk files in datapath
-  createMobileMapPackages(0);
+  // list the mmpk files in datapath; packages are only loaded once selected
+  createMobileMapPackages();
 
   // create graphics overlays to visually display geocoding and routing results
   m_stopsGraphicsOverlay = new GraphicsOverlay(this);
@@ -121,38 +122,64 @@ void MobileMap_SearchAndRoute::componentComplete()
   connectSignals();
 }
 
-void MobileMap_SearchAndRoute::createMobileMapPackages(int index)
+void MobileMap_SearchAndRoute::createMobileMapPackages()
 {
-  if (index < m_fileInfoList.length())
+  // QStringList of MobileMapPackage names. Used as a ListModel in QML
+  connect(m_catalog, &MobileMapPackageCatalog::entryAdded, this, [this](int index)
   {
-    // check if file is a .mmpk file
-    if (m_fileInfoList[index].completeSuffix() == "mmpk")
-    {
-      // create a new MobileMapPackage
-      MobileMapPackage* mobileMapPackage = new MobileMapPackage(m_fileInfoList[index].absoluteFilePath(), this);
+    m_mobileMapPackageList << m_catalog->entries().at(index).title;
+    emit mmpkListChanged();
+  });
 
-      // once MMPK is finished loading, add it and its information to lists
-      connect(mobileMapPackage, &MobileMapPackage::doneLoading, this, [mobileMapPackage, this](Error error)
-      {
-        if (error.isEmpty())
-        {
-          // QList of MobileMapPackages
-          m_mobileMapPackages.append(mobileMapPackage);
+  connect(m_catalog, &MobileMapPackageCatalog::scanCompleted, this, [this](int cachedCount, int readCount, qint64 msecs)
+  {
+    m_catalogStatus = QString("%1 packages listed in %2 ms (%3 from cache, %4 read), %5 ms since startup")
+        .arg(cachedCount + readCount).arg(msecs).arg(cachedCount).arg(readCount).arg(m_startupTimer.elapsed());
+    emit catalogStatusChanged();
+  });
 
-          // QStringList of MobileMapPackage names. Used as a ListModel in QML
-          m_mobileMapPackageList << mobileMapPackage->item()->title();
-          emit mmpkListChanged();
-        }
-      });
+  m_catalog->scan(m_dataPath);
+}
 
-      // load the new MMPK
-      mobileMapPackage->load();
+// Loads the selected package, releasing the previously selected one, and
+// lists its maps once it has loaded.
+void MobileMap_SearchAndRoute::loadMobileMapPackage(int index)
+{
+  const QString path = m_catalog->entries().at(index).path;
+  if (m_mobileMap && m_mobileMap->path() == path && m_mobileMap->loadStatus() != LoadStatus::FailedToLoad)
+  {
+    if (m_mobileMap->loadStatus() == LoadStatus::Loaded)
+      createMapList(index);
+
+    return;
+  }
+
+  // release everything that uses the previous package before deleting it
+  if (m_mobileMap)
+  {
+    resetMapView();
+    m_mapView->setMap(nullptr);
+    m_currentLocatorTask = nullptr;
+    if (m_currentRouteTask)
+    {
+      m_currentRouteTask->deleteLater();
+      m_currentRouteTask = nullptr;
     }
 
-    createMobileMapPackages(++index);
+    m_mobileMap->deleteLater();
   }
-  else
-    return;
+
+  MobileMapPackage* mobileMapPackage = new MobileMapPackage(path, this);
+  connect(mobileMapPackage, &MobileMapPackage::doneLoading, this, [this, mobileMapPackage, index](Error error)
+  {
+    // another package may have been selected in the meantime
+    if (error.isEmpty() && mobileMapPackage == m_mobileMap)
+      createMapList(index);
+  });
+
+  m_mobileMap = mobileMapPackage;
+
+  m_mobileMap->load();
 }
 
 void MobileMap_SearchAndRoute::connectSignals()
@@ -229,13 +256,21 @@ void MobileMap_SearchAndRoute::createMapList(int index)
   m_mapList.clear();
   m_selectedMmpkIndex = index;
 
+  // the maps are listed once the selected package has loaded
+  if (!m_mobileMap || m_mobileMap->path() != m_catalog->entries().at(index).path || m_mobileMap->loadStatus() != LoadStatus::Loaded)
+  {
+    emit mapListChanged();
+    loadMobileMapPackage(index);
+    return;
+  }
+
   int counter = 1;
 
-  for (const Map* map : m_mobileMapPackages[index]->maps())
+  for (const Map* map : m_mobileMap->maps())
   {
     QVariantMap mapList;
     mapList["name"] = map->item()->title() + " " + QString::number(counter);
-    mapList["geocoding"] = m_mobileMapPackages[index]->locatorTask() != nullptr;
+    mapList["geocoding"] = m_mobileMap->locatorTask() != nullptr;
     mapList["routing"] = map->transportationNetworks().count() > 0;
 
     m_mapList << mapList;
@@ -251,11 +286,11 @@ void MobileMap_SearchAndRoute::selectMap(int index)
 
   // set the locatorTask
   //! [MobileMap_SearchAndRoute create LocatorTask]
-  m_currentLocatorTask = m_mobileMapPackages[m_selectedMmpkIndex]->locatorTask();
+  m_currentLocatorTask = m_mobileMap->locatorTask();
   //! [MobileMap_SearchAndRoute create LocatorTask]
 
   // set the MapView
-  m_mapView->setMap(m_mobileMapPackages[m_selectedMmpkIndex]->maps().at(index));
+  m_mapView->setMap(m_mobileMap->maps().at(index));
 
   if (m_currentLocatorTask)
   {
@@ -313,9 +348,9 @@ void MobileMap_SearchAndRoute::selectMap(int index)
   }
 
   // create a RouteTask with selected map's transportation network if available
-  if (m_mobileMapPackages[m_selectedMmpkIndex]->maps().at(index)->transportationNetworks().count() > 0)
+  if (m_mobileMap->maps().at(index)->transportationNetworks().count() > 0)
   {
-    m_currentRouteTask = new RouteTask(m_mobileMapPackages[m_selectedMmpkIndex]->maps().at(index)->transportationNetworks().at(0), this);
+    m_currentRouteTask = new RouteTask(m_mobileMap->maps().at(index)->transportationNetworks().at(0), this);
     m_currentRouteTask->load();
 
     // create default parameters after the RouteTask is loaded
@@ -373,6 +408,11 @@ QVariantList MobileMap_SearchAndRoute::mapList() const
   return m_mapList;
 }
 
+QString MobileMap_SearchAndRoute::catalogStatus() const
+{
+  return m_catalogStatus;
+}
+
 bool MobileMap_SearchAndRoute::isGeocodeInProgress() const
 {
   return m_isGeocodeInProgress;
@@ -37,10 +37,12 @@ namespace Esri
 #include "RouteParameters.h"
 #include "ReverseGeocodeParameters.h"
 
+#include <QElapsedTimer>
 #include <QQuickItem>
-#include <QFileInfoList>
 #include <QVariantMap>
 
+class MobileMapPackageCatalog;
+
 class MobileMap_SearchAndRoute : public QQuickItem
 {
   Q_OBJECT
@@ -50,6 +52,7 @@ class MobileMap_SearchAndRoute : public QQuickItem
   Q_PROPERTY(bool isGeocodeInProgress READ isGeocodeInProgress NOTIFY isGeocodeInProgressChanged)
   Q_PROPERTY(QStringList mmpkList READ mmpkList NOTIFY mmpkListChanged)
   Q_PROPERTY(QVariantList mapList READ mapList NOTIFY mapListChanged)
+  Q_PROPERTY(QString catalogStatus READ catalogStatus NOTIFY catalogStatusChanged)
 
 public:
   explicit MobileMap_SearchAndRoute(QQuickItem* parent = nullptr);
@@ -68,15 +71,18 @@ signals:
   void canClearChanged();
   void canRouteChanged();
   void isGeocodeInProgressChanged();
+  void catalogStatusChanged();
 
 private:
   void connectSignals();
   bool canRoute() const;
   bool canClear() const;
-  void createMobileMapPackages(int index);
+  void createMobileMapPackages();
+  void loadMobileMapPackage(int index);
   QStringList mmpkList() const;
   QVariantList mapList() const;
   bool isGeocodeInProgress() const;
+  QString catalogStatus() const;
 
 private:
   int m_selectedMmpkIndex = 0;
@@ -84,14 +90,15 @@ private:
   bool m_canClear = false;
   bool m_isGeocodeInProgress = false;
   QString m_dataPath;
-  QFileInfoList m_fileInfoList;
   QStringList m_mobileMapPackageList;
+  QString m_catalogStatus;
+  QElapsedTimer m_startupTimer;
   QVariantList m_mapList;
   Esri::ArcGISRuntime::Point m_clickedPoint;
   Esri::ArcGISRuntime::RouteParameters m_currentRouteParameters;
   Esri::ArcGISRuntime::ReverseGeocodeParameters m_reverseGeocodeParameters;
   QList<Esri::ArcGISRuntime::Stop> m_stops;
-  QList<Esri::ArcGISRuntime::MobileMapPackage*> m_mobileMapPackages;
+  MobileMapPackageCatalog* m_catalog = nullptr;
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   Esri::ArcGISRuntime::MobileMapPackage* m_mobileMap = nullptr;
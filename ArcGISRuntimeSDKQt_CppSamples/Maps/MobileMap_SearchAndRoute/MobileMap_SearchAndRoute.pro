@@ -41,9 +41,9 @@ TARGET = MobileMap_SearchAndRoute
 
 #-------------------------------------------------------------------------------
 
-HEADERS += MobileMap_SearchAndRoute.h
+HEADERS += MobileMap_SearchAndRoute.h MobileMapPackageCatalog.h
 
-SOURCES += main.cpp MobileMap_SearchAndRoute.cpp
+SOURCES += main.cpp MobileMap_SearchAndRoute.cpp MobileMapPackageCatalog.cpp
 
 RESOURCES += MobileMap_SearchAndRoute.qrc
 
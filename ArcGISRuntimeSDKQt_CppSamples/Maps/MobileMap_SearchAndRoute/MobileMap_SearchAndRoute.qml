@@ -201,6 +201,13 @@ MobileMap_SearchAndRouteSample {
                         }
                     }
 
+                    Text {
+                        anchors.horizontalCenter: parent.horizontalCenter
+                        text: mobileMapSearchRoute.catalogStatus
+                        visible: text.length > 0
+                        color: "gray"
+                    }
+
                     // mobile map package ListView
                     ListView {
                         anchors.horizontalCenter: parent.horizontalCenter
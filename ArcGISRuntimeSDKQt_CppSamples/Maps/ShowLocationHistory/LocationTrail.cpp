@@ -0,0 +1,190 @@
+// [WriteFile Name=ShowLocationHistory, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "LocationTrail.h"
+
+#include "Graphic.h"
+#include "GraphicsOverlay.h"
+#include "Multipoint.h"
+#include "MultipointBuilder.h"
+#include "PointCollection.h"
+#include "Polyline.h"
+#include "PolylineBuilder.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Esri::ArcGISRuntime;
+
+LocationTrail::LocationTrail(GraphicsOverlay* lineOverlay, GraphicsOverlay* pointOverlay, QObject* parent /* = nullptr */):
+  QObject(parent),
+  m_lineOverlay(lineOverlay),
+  m_pointOverlay(pointOverlay)
+{
+}
+
+LocationTrail::~LocationTrail() = default;
+
+void LocationTrail::setSegmentSize(int segmentSize)
+{
+  if (segmentSize > 1)
+    m_segmentSize = segmentSize;
+}
+
+void LocationTrail::setMaximumPointCount(int maximumPointCount)
+{
+  m_maximumPointCount = std::max(0, maximumPointCount);
+  evict(m_lastTimestamp);
+}
+
+void LocationTrail::setRetentionWindow(qint64 retentionMs)
+{
+  m_retentionMs = std::max<qint64>(0, retentionMs);
+  evict(m_lastTimestamp);
+}
+
+void LocationTrail::setMinimumDistance(double minimumDistance)
+{
+  m_minimumDistance = std::max(0.0, minimumDistance);
+}
+
+void LocationTrail::setMinimumInterval(qint64 minimumIntervalMs)
+{
+  m_minimumIntervalMs = std::max<qint64>(0, minimumIntervalMs);
+}
+
+bool LocationTrail::append(const Point& position, const QDateTime& timestamp)
+{
+  if (!position.isValid() || !accept(position, timestamp))
+    return false;
+
+  if (m_segments.empty() || m_segments.back().m_pointCount >= m_segmentSize)
+  {
+    if (!m_segments.empty())
+      sealSegment(m_segments.back());
+
+    startSegment(position);
+  }
+
+  Segment& tail = m_segments.back();
+  tail.m_lineBuilder->addPoint(position);
+  tail.m_pointBuilder->points()->addPoint(position);
+  tail.m_lastTimestamp = timestamp;
+  ++tail.m_pointCount;
+  ++m_pointCount;
+
+  // only the tail segment is rebuilt, its size is bounded by the segment size
+  tail.m_lineGraphic->setGeometry(tail.m_lineBuilder->toGeometry());
+  tail.m_pointGraphic->setGeometry(tail.m_pointBuilder->toGeometry());
+
+  m_lastPosition = position;
+  m_lastTimestamp = timestamp;
+
+  evict(timestamp);
+  return true;
+}
+
+void LocationTrail::clear()
+{
+  while (!m_segments.empty())
+    removeOldestSegment();
+
+  m_lastPosition = Point();
+  m_lastTimestamp = QDateTime();
+}
+
+bool LocationTrail::accept(const Point& position, const QDateTime& timestamp) const
+{
+  if (!m_lastPosition.isValid())
+    return true;
+
+  if (m_minimumIntervalMs > 0 && m_lastTimestamp.isValid() && timestamp.isValid() &&
+      m_lastTimestamp.msecsTo(timestamp) < m_minimumIntervalMs)
+  {
+    return false;
+  }
+
+  if (m_minimumDistance > 0.0 &&
+      std::hypot(position.x() - m_lastPosition.x(), position.y() - m_lastPosition.y()) < m_minimumDistance)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+void LocationTrail::startSegment(const Point& position)
+{
+  Segment segment;
+  segment.m_lineBuilder = new PolylineBuilder(position.spatialReference(), this);
+  segment.m_pointBuilder = new MultipointBuilder(position.spatialReference(), this);
+
+  // start the line at the end of the previous segment so the trail stays connected
+  if (m_lastPosition.isValid())
+    segment.m_lineBuilder->addPoint(m_lastPosition);
+
+  segment.m_lineGraphic = new Graphic(this);
+  segment.m_pointGraphic = new Graphic(this);
+  m_lineOverlay->graphics()->append(segment.m_lineGraphic);
+  m_pointOverlay->graphics()->append(segment.m_pointGraphic);
+
+  m_segments.push_back(segment);
+}
+
+void LocationTrail::sealSegment(Segment& segment)
+{
+  // a full segment never changes again, so its geometry is kept on the
+  // graphics and the builders are released
+  delete segment.m_lineBuilder;
+  segment.m_lineBuilder = nullptr;
+  delete segment.m_pointBuilder;
+  segment.m_pointBuilder = nullptr;
+}
+
+void LocationTrail::evict(const QDateTime& now)
+{
+  // the tail segment is never evicted
+  while (m_segments.size() > 1)
+  {
+    const Segment& oldest = m_segments.front();
+    const bool overCount = m_maximumPointCount > 0 && m_pointCount > m_maximumPointCount;
+    const bool overAge = m_retentionMs > 0 && oldest.m_lastTimestamp.isValid() && now.isValid() &&
+                         oldest.m_lastTimestamp.msecsTo(now) > m_retentionMs;
+
+    if (!overCount && !overAge)
+      return;
+
+    removeOldestSegment();
+  }
+}
+
+void LocationTrail::removeOldestSegment()
+{
+  Segment& oldest = m_segments.front();
+
+  m_lineOverlay->graphics()->removeOne(oldest.m_lineGraphic);
+  m_pointOverlay->graphics()->removeOne(oldest.m_pointGraphic);
+  delete oldest.m_lineGraphic;
+  delete oldest.m_pointGraphic;
+  sealSegment(oldest);
+
+  m_pointCount -= oldest.m_pointCount;
+  m_segments.pop_front();
+}
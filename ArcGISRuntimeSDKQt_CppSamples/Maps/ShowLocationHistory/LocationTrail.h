@@ -0,0 +1,107 @@
+// [WriteFile Name=ShowLocationHistory, Category=Maps]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef LOCATIONTRAIL_H
+#define LOCATIONTRAIL_H
+
+#include "Point.h"
+
+#include <QDateTime>
+#include <QObject>
+
+#include <deque>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+class Graphic;
+class GraphicsOverlay;
+class MultipointBuilder;
+class PolylineBuilder;
+}
+}
+
+// Stores a location history as a sequence of fixed size segments. Each segment
+// is drawn with one polyline graphic and one multipoint graphic, and only the
+// newest segment is rebuilt when a position is appended, so the cost of adding
+// a fix does not depend on the length of the trail.
+class LocationTrail : public QObject
+{
+  Q_OBJECT
+
+public:
+  LocationTrail(Esri::ArcGISRuntime::GraphicsOverlay* lineOverlay,
+                Esri::ArcGISRuntime::GraphicsOverlay* pointOverlay,
+                QObject* parent = nullptr);
+  ~LocationTrail() override;
+
+  // number of positions stored in each segment
+  void setSegmentSize(int segmentSize);
+  int segmentSize() const { return m_segmentSize; }
+
+  // oldest segments are dropped once the trail holds more than this many
+  // positions or once they are older than the retention window. 0 disables.
+  void setMaximumPointCount(int maximumPointCount);
+  int maximumPointCount() const { return m_maximumPointCount; }
+  void setRetentionWindow(qint64 retentionMs);
+  qint64 retentionWindow() const { return m_retentionMs; }
+
+  // positions closer than the minimum distance (in the units of the
+  // position's spatial reference) or the minimum interval to the previous
+  // stored position are skipped. 0 disables.
+  void setMinimumDistance(double minimumDistance);
+  double minimumDistance() const { return m_minimumDistance; }
+  void setMinimumInterval(qint64 minimumIntervalMs);
+  qint64 minimumInterval() const { return m_minimumIntervalMs; }
+
+  bool append(const Esri::ArcGISRuntime::Point& position, const QDateTime& timestamp);
+  void clear();
+
+  int pointCount() const { return m_pointCount; }
+  int segmentCount() const { return static_cast<int>(m_segments.size()); }
+
+private:
+  struct Segment
+  {
+    Esri::ArcGISRuntime::Graphic* m_lineGraphic = nullptr;
+    Esri::ArcGISRuntime::Graphic* m_pointGraphic = nullptr;
+    Esri::ArcGISRuntime::PolylineBuilder* m_lineBuilder = nullptr;
+    Esri::ArcGISRuntime::MultipointBuilder* m_pointBuilder = nullptr;
+    QDateTime m_lastTimestamp;
+    int m_pointCount = 0;
+  };
+
+  bool accept(const Esri::ArcGISRuntime::Point& position, const QDateTime& timestamp) const;
+  void startSegment(const Esri::ArcGISRuntime::Point& position);
+  void sealSegment(Segment& segment);
+  void evict(const QDateTime& now);
+  void removeOldestSegment();
+
+  Esri::ArcGISRuntime::GraphicsOverlay* m_lineOverlay = nullptr;
+  Esri::ArcGISRuntime::GraphicsOverlay* m_pointOverlay = nullptr;
+  std::deque<Segment> m_segments;
+  Esri::ArcGISRuntime::Point m_lastPosition;
+  QDateTime m_lastTimestamp;
+  int m_segmentSize = 64;
+  int m_maximumPointCount = 0;
+  qint64 m_retentionMs = 0;
+  double m_minimumDistance = 0.0;
+  qint64 m_minimumIntervalMs = 0;
+  int m_pointCount = 0;
+};
+
+#endif // LOCATIONTRAIL_H
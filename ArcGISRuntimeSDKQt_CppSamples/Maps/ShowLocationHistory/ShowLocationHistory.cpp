@@ -20,14 +20,13 @@
 
 #include "ShowLocationHistory.h"
 
-#include "GeometryEngine.h"
-#include "Graphic.h"
+#include "LocationTrail.h"
+
 #include "GraphicsOverlay.h"
 #include "Location.h"
 #include "Map.h"
 #include "MapQuickView.h"
 #include "Polyline.h"
-#include "PolylineBuilder.h"
 #include "SimpleLineSymbol.h"
 #include "SimpleMarkerSymbol.h"
 #include "SimpleRenderer.h"
@@ -39,6 +38,9 @@ using namespace Esri::ArcGISRuntime;
 namespace
 {
 constexpr int initialZoomScale = 8000;
+// positions per trail segment and the number of positions kept on the map
+constexpr int trailSegmentSize = 64;
+constexpr int trailMaximumPointCount = 10000;
 const Point initialCenter(-13185535.98, 4037766.28);
 const QString polylineJson("{\"paths\":[[[-13185646.046666779,4037971.5966668758],[-13185586.780000051,4037827.6633333955],"
                            "[-13185514.813333312,4037709.1299999417],[-13185569.846666701,4037522.8633330846],"
@@ -98,14 +100,16 @@ ShowLocationHistory::ShowLocationHistory(QObject* parent /* = nullptr */):
   // graphics overlay for displaying the trail
   SimpleLineSymbol* locationLineSymbol = new SimpleLineSymbol(SimpleLineSymbolStyle::Solid, Qt::green, 2, this);
   m_locationHistoryLineOverlay->setRenderer(new SimpleRenderer(locationLineSymbol, this));
-  m_locationHistoryLineGraphic = new Graphic(this);
-  m_locationHistoryLineOverlay->graphics()->append(m_locationHistoryLineGraphic);
 
   // graphics overlay for showing points
   SimpleMarkerSymbol* locationPointSymbol = new SimpleMarkerSymbol(SimpleMarkerSymbolStyle::Circle, Qt::red, 3, this);
   m_locationHistoryOverlay->setRenderer(new SimpleRenderer(locationPointSymbol, this));
 
-  m_polylineBuilder = new PolylineBuilder(SpatialReference::webMercator(), this);
+  // the trail draws each segment of the history as one line and one multipoint graphic
+  m_locationTrail = new LocationTrail(m_locationHistoryLineOverlay, m_locationHistoryOverlay, this);
+  m_locationTrail->setSegmentSize(trailSegmentSize);
+  m_locationTrail->setMaximumPointCount(trailMaximumPointCount);
+
   m_simulatedLocationDataSource = new SimulatedLocationDataSource(this);
 }
 
@@ -130,20 +134,8 @@ void ShowLocationHistory::handleLocationChanges()
       return;
     }
 
-    // clear old route
-    m_locationHistoryLineGraphic->setGeometry(Geometry());
-
-    if (m_lastPosition.isValid())
-    {
-      m_polylineBuilder->addPoint(m_lastPosition);
-      m_locationHistoryOverlay->graphics()->append(new Graphic(m_lastPosition, this));
-    }
-
-    // store the current position
-    m_lastPosition = location.position();
-
-    // update the polyline
-    m_locationHistoryLineGraphic->setGeometry(m_polylineBuilder->toGeometry());
+    // append the position to the trail, only the newest segment is redrawn
+    m_locationTrail->append(location.position(), location.timestamp());
   });
 }
 
@@ -17,23 +17,21 @@
 #ifndef SHOWLOCATIONHISTORY_H
 #define SHOWLOCATIONHISTORY_H
 
-#include "Point.h"
-
 #include <QObject>
 
 namespace Esri
 {
 namespace ArcGISRuntime
 {
-class Graphic;
 class GraphicsOverlay;
 class Map;
 class MapQuickView;
-class PolylineBuilder;
 class SimulatedLocationDataSource;
 }
 }
 
+class LocationTrail;
+
 class ShowLocationHistory : public QObject
 {
   Q_OBJECT
@@ -60,10 +58,8 @@ private:
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   Esri::ArcGISRuntime::GraphicsOverlay* m_locationHistoryOverlay = nullptr;
   Esri::ArcGISRuntime::GraphicsOverlay* m_locationHistoryLineOverlay = nullptr;
-  Esri::ArcGISRuntime::Graphic* m_locationHistoryLineGraphic = nullptr;
-  Esri::ArcGISRuntime::PolylineBuilder* m_polylineBuilder = nullptr;
   Esri::ArcGISRuntime::SimulatedLocationDataSource* m_simulatedLocationDataSource = nullptr;
-  Esri::ArcGISRuntime::Point m_lastPosition;
+  LocationTrail* m_locationTrail = nullptr;
   bool m_trackingEnabled = false;
 };
 
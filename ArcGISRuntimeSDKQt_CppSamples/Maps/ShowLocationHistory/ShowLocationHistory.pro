@@ -33,10 +33,12 @@ include($$PWD/arcgisruntime.pri)
 #-------------------------------------------------------------------------------
 
 HEADERS += \
+    LocationTrail.h \
     ShowLocationHistory.h
 
 SOURCES += \
     main.cpp \
+    LocationTrail.cpp \
     ShowLocationHistory.cpp
 
 RESOURCES += ShowLocationHistory.qrc
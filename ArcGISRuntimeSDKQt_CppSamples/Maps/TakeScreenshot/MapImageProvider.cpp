@@ -23,15 +23,20 @@ MapImageProvider::MapImageProvider() :
 // reimplemented function for QML to request Images from the provider
 QImage MapImageProvider::requestImage(const QString& id, QSize* size, const QSize &requestedSize)
 {  
-  Q_UNUSED(size)
-  Q_UNUSED(requestedSize)
-  return m_images[id];
+  // images are served from a bounded LRU cache, scaled down to the requested size
+  return m_images.image(id, size, requestedSize);
 }
 
 // helper to add images to the the provider
 void MapImageProvider::addImage(const QString& id, const QImage& img)
 {
-  m_images[id] = img;
+  m_images.insert(id, img);
+}
+
+// the cache holding the images, e.g. to configure its budget or read its statistics
+ImageCache& MapImageProvider::cache()
+{
+  return m_images;
 }
 
 // static function to return the image provider id
@@ -14,9 +14,10 @@
 #ifndef MAPIMAGEPROVIDER_H
 #define MAPIMAGEPROVIDER_H
 
+#include "ImageCache.h"
+
 // Qt headers
 #include <QImage>
-#include <QMap>
 #include <QQuickImageProvider>
 
 class MapImageProvider : public QQuickImageProvider
@@ -29,10 +30,11 @@ public:
 public:
   QImage requestImage(const QString& id, QSize* size, const QSize& requestedSize) override;
   void addImage(const QString& id, const QImage& img);
+  ImageCache& cache();
   static QString imageProviderId();
 
 private:
-  QMap<QString, QImage> m_images;
+  ImageCache m_images;
 };
 
 #endif // MAPIMAGEPROVIDER_H
@@ -57,6 +57,14 @@ void TakeScreenshot::componentComplete()
   QQmlEngine* engine = QQmlEngine::contextForObject(this)->engine();
   m_imageProvider = dynamic_cast<MapImageProvider*>(engine->imageProvider(MapImageProvider::imageProviderId()));
 
+  // screenshots evicted from the provider's memory budget are kept on disk, and
+  // the statistics are refreshed whenever the cache reports a change
+  if (m_imageProvider)
+  {
+    m_imageProvider->cache().enableSpilling("TakeScreenshot");
+    connect(&m_imageProvider->cache(), &ImageCache::statisticsChanged, this, &TakeScreenshot::updateImageCacheStatistics);
+  }
+
   // Connect to the exportImageCompleted signal
   connect(m_mapView, &MapQuickView::exportImageCompleted, this, [this](QUuid id, QImage img)
   {
@@ -81,3 +89,21 @@ QUrl TakeScreenshot::mapImageUrl() const
 {
   return m_mapImageUrl;
 }
+
+QString TakeScreenshot::imageCacheStatistics() const
+{
+  return m_imageCacheStatistics;
+}
+
+void TakeScreenshot::updateImageCacheStatistics()
+{
+  if (!m_imageProvider)
+    return;
+
+  const QString statistics = m_imageProvider->cache().statistics().toString();
+  if (statistics == m_imageCacheStatistics)
+    return;
+
+  m_imageCacheStatistics = statistics;
+  emit imageCacheStatisticsChanged();
+}
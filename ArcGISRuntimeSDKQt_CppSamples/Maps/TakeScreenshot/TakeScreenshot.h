@@ -35,6 +35,7 @@ class TakeScreenshot : public QQuickItem
   Q_OBJECT
 
   Q_PROPERTY(QUrl mapImageUrl READ mapImageUrl NOTIFY mapImageUrlChanged)
+  Q_PROPERTY(QString imageCacheStatistics READ imageCacheStatistics NOTIFY imageCacheStatisticsChanged)
 
 public:
   explicit TakeScreenshot(QQuickItem* parent = nullptr);
@@ -46,15 +47,19 @@ public:
 
 signals:
   void mapImageUrlChanged();
+  void imageCacheStatisticsChanged();
 
 private:
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
   MapImageProvider* m_imageProvider = nullptr;
   QUrl m_mapImageUrl;
+  QString m_imageCacheStatistics;
 
 private:
   QUrl mapImageUrl() const;
+  QString imageCacheStatistics() const;
+  void updateImageCacheStatistics();
 };
 
 #endif // TAKESCREENSHOT_H
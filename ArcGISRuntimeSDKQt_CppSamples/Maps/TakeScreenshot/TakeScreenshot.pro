@@ -43,6 +43,8 @@ SOURCES += \
 
 RESOURCES += TakeScreenshot.qrc
 
+include($$PWD/../../Shared/ImageCache/ImageCache.pri)
+
 #-------------------------------------------------------------------------------
 
 win32 {
@@ -43,6 +43,16 @@ TakeScreenshotSample {
                 busyIndicator.visible = true;
             }
         }
+
+        Label {
+            anchors {
+                left: parent.left
+                top: parent.top
+                margins: 10
+            }
+            text: "Screenshot cache: " + imageCacheStatistics
+            color: "white"
+        }
     }
 
     onMapImageUrlChanged: {
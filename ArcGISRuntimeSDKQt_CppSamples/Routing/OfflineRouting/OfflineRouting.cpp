@@ -39,9 +39,11 @@
 #include "TextSymbol.h"
 #include "TileCache.h"
 
+#include <algorithm>
 #include <memory>
 #include <QDir>
 #include <QScopedPointer>
+#include <QTimer>
 
 using namespace Esri::ArcGISRuntime;
 
@@ -69,8 +71,12 @@ OfflineRouting::OfflineRouting(QObject* parent /* = nullptr */):
   QObject(parent),
   m_pinSymbol(new PictureMarkerSymbol(pinUrl, this)),
   m_stopsOverlay(new GraphicsOverlay(this)),
-  m_routeOverlay(new GraphicsOverlay(this))
+  m_routeOverlay(new GraphicsOverlay(this)),
+  m_solveIntervalTimer(new QTimer(this))
 {
+  m_solveIntervalTimer->setSingleShot(true);
+  connect(m_solveIntervalTimer, &QTimer::timeout, this, &OfflineRouting::solvePendingRoute);
+
   const QString folderLocation = QString("%1/ArcGIS/Runtime/Data/tpk/san_diego").arg(defaultDataPath());
   if (!QFileInfo::exists(folderLocation))
   {
@@ -135,10 +141,47 @@ void OfflineRouting::setTravelModeIndex(int index)
   if (m_travelModeIndex == index)
     return;
 
+  // a route solved for the previous travel mode is of no use anymore
+  cancelActiveSolve();
+
   m_travelModeIndex = index;
   emit travelModeIndexChanged();
 }
 
+int OfflineRouting::minimumSolveInterval() const
+{
+  return m_minimumSolveInterval;
+}
+
+void OfflineRouting::setMinimumSolveInterval(int intervalMs)
+{
+  if (intervalMs < 0 || m_minimumSolveInterval == intervalMs)
+    return;
+
+  m_minimumSolveInterval = intervalMs;
+  emit minimumSolveIntervalChanged();
+}
+
+int OfflineRouting::solveCount() const
+{
+  return m_solveCount;
+}
+
+qint64 OfflineRouting::lastSolveLatency() const
+{
+  return m_lastSolveLatency;
+}
+
+double OfflineRouting::averageSolveLatency() const
+{
+  return m_solveCount > 0 ? static_cast<double>(m_totalSolveLatency) / m_solveCount : 0.0;
+}
+
+qint64 OfflineRouting::maxSolveLatency() const
+{
+  return m_maxSolveLatency;
+}
+
 int OfflineRouting::travelModeIndex() const
 {
   return m_travelModeIndex;
@@ -231,8 +274,18 @@ void OfflineRouting::connectSignals()
     }
   });
 
-  connect(m_routeTask, &RouteTask::solveRouteCompleted, this, [this](QUuid, const RouteResult routeResult){
-    if (routeResult.isEmpty())
+  connect(m_routeTask, &RouteTask::solveRouteCompleted, this, [this](QUuid taskId, const RouteResult routeResult){
+    // ignore results of solves which were cancelled
+    if (taskId != m_activeSolveId)
+      return;
+
+    m_activeSolveId = QUuid();
+    recordSolveLatency(m_solveClock.elapsed());
+
+    // solve the latest stop configuration if stops moved while this one was in flight
+    solvePendingRoute();
+
+    if (routeResult.isEmpty() || m_stopsOverlay->graphics()->size() < 2)
       return;
 
     // clear old route
@@ -242,14 +295,45 @@ void OfflineRouting::connectSignals()
 
     m_routeOverlay->graphics()->append(routeGraphic);
   });
+
+  connect(m_routeTask, &RouteTask::errorOccurred, this, [this](Error e){
+    // the error does not name its task. It frees the slot whenever a solve is
+    // in flight and has not been cancelled, so a failed solve never blocks the
+    // solves that follow it.
+    if (m_activeSolveId.isNull() || m_taskWatcher.isCanceled())
+      return;
+
+    qDebug() << e.message() << e.additionalMessage();
+    m_activeSolveId = QUuid();
+    solvePendingRoute();
+  });
 }
 
 void OfflineRouting::findRoute()
 {
-  if(!m_taskWatcher.isDone())
+  // only remember that the current stops need solving. While a stop is dragged
+  // the positions in between are coalesced and the latest one is solved as soon
+  // as the solve in flight has finished.
+  m_routeRequested = true;
+  solvePendingRoute();
+}
+
+void OfflineRouting::solvePendingRoute()
+{
+  if (!m_routeRequested || !m_activeSolveId.isNull() || !m_routeTask)
     return;
 
-  if (m_stopsOverlay->graphics()->size() > 1)
+  // honour the minimum interval between two solves
+  if (m_solveClock.isValid() && m_solveClock.elapsed() < m_minimumSolveInterval)
+  {
+    if (!m_solveIntervalTimer->isActive())
+      m_solveIntervalTimer->start(static_cast<int>(m_minimumSolveInterval - m_solveClock.elapsed()));
+    return;
+  }
+
+  m_routeRequested = false;
+
+  if (m_stopsOverlay->graphics()->size() > 1 && m_travelModeIndex >= 0)
   {
     QList<Stop> stops;
     for (const Graphic* graphic : *m_stopsOverlay->graphics())
@@ -261,10 +345,30 @@ void OfflineRouting::findRoute()
     m_routeParameters.setStops(stops);
     m_routeParameters.setTravelMode(m_routeTask->routeTaskInfo().travelModes().at(m_travelModeIndex));
 
+    m_solveClock.start();
     m_taskWatcher = m_routeTask->solveRoute(m_routeParameters);
+    m_activeSolveId = m_taskWatcher.taskId();
   }
 }
 
+void OfflineRouting::cancelActiveSolve()
+{
+  if (m_activeSolveId.isNull())
+    return;
+
+  m_taskWatcher.cancel();
+  m_activeSolveId = QUuid();
+}
+
+void OfflineRouting::recordSolveLatency(qint64 latencyMs)
+{
+  ++m_solveCount;
+  m_lastSolveLatency = latencyMs;
+  m_totalSolveLatency += latencyMs;
+  m_maxSolveLatency = std::max(m_maxSolveLatency, latencyMs);
+  emit solveStatisticsChanged();
+}
+
 // Set the view (created in QML)
 void OfflineRouting::setMapView(MapQuickView* mapView)
 {
@@ -291,6 +395,9 @@ void OfflineRouting::setMapView(MapQuickView* mapView)
 
 void OfflineRouting::resetMap()
 {
+  cancelActiveSolve();
+  m_routeRequested = false;
+  m_solveIntervalTimer->stop();
   m_selectedGraphic = nullptr;
   if (m_stopsOverlay)
     m_stopsOverlay->graphics()->clear();
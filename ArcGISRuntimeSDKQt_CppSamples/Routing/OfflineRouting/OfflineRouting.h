@@ -34,7 +34,11 @@ class RouteTask;
 }
 }
 
+#include <QElapsedTimer>
 #include <QObject>
+#include <QUuid>
+
+class QTimer;
 
 class OfflineRouting : public QObject
 {
@@ -43,6 +47,11 @@ class OfflineRouting : public QObject
   Q_PROPERTY(Esri::ArcGISRuntime::MapQuickView* mapView READ mapView WRITE setMapView NOTIFY mapViewChanged)
   Q_PROPERTY(QStringList travelModeNames READ travelModeNames NOTIFY travelModeNamesChanged)
   Q_PROPERTY(int travelModeIndex READ travelModeIndex WRITE setTravelModeIndex NOTIFY travelModeIndexChanged)
+  Q_PROPERTY(int minimumSolveInterval READ minimumSolveInterval WRITE setMinimumSolveInterval NOTIFY minimumSolveIntervalChanged)
+  Q_PROPERTY(int solveCount READ solveCount NOTIFY solveStatisticsChanged)
+  Q_PROPERTY(qint64 lastSolveLatency READ lastSolveLatency NOTIFY solveStatisticsChanged)
+  Q_PROPERTY(double averageSolveLatency READ averageSolveLatency NOTIFY solveStatisticsChanged)
+  Q_PROPERTY(qint64 maxSolveLatency READ maxSolveLatency NOTIFY solveStatisticsChanged)
 
 public:
   explicit OfflineRouting(QObject* parent = nullptr);
@@ -59,6 +68,8 @@ signals:
   void mapViewChanged();
   void travelModeNamesChanged();
   void travelModeIndexChanged();
+  void minimumSolveIntervalChanged();
+  void solveStatisticsChanged();
 
 private:
   Esri::ArcGISRuntime::MapQuickView* mapView() const;
@@ -67,6 +78,16 @@ private:
   QStringList travelModeNames() const;
   int travelModeIndex() const;
   void setTravelModeIndex(int index);
+  int minimumSolveInterval() const;
+  void setMinimumSolveInterval(int intervalMs);
+  int solveCount() const;
+  qint64 lastSolveLatency() const;
+  double averageSolveLatency() const;
+  qint64 maxSolveLatency() const;
+
+  void solvePendingRoute();
+  void cancelActiveSolve();
+  void recordSolveLatency(qint64 latencyMs);
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
@@ -78,6 +99,15 @@ private:
   Esri::ArcGISRuntime::RouteTask* m_routeTask = nullptr;
   Esri::ArcGISRuntime::RouteParameters m_routeParameters;
   Esri::ArcGISRuntime::TaskWatcher m_taskWatcher;
+  QUuid m_activeSolveId;
+  QTimer* m_solveIntervalTimer = nullptr;
+  QElapsedTimer m_solveClock;
+  bool m_routeRequested = false;
+  int m_minimumSolveInterval = 0;
+  int m_solveCount = 0;
+  qint64 m_lastSolveLatency = 0;
+  qint64 m_totalSolveLatency = 0;
+  qint64 m_maxSolveLatency = 0;
   int m_travelModeIndex = -1;
   Esri::ArcGISRuntime::Envelope m_routableArea;
 };
@@ -52,6 +52,17 @@ Item {
         }
     }
 
+    Text {
+        anchors {
+            left: parent.left
+            bottom: view.attributionTop
+            margins: 5
+        }
+        visible: routingModel.solveCount > 0
+        text: "Solve latency: " + routingModel.lastSolveLatency + " ms (avg " +
+              routingModel.averageSolveLatency.toFixed(0) + " ms, max " + routingModel.maxSolveLatency + " ms)"
+    }
+
     // Declare the C++ instance which creates the scene etc. and supply the view
     OfflineRoutingSample {
         id: routingModel
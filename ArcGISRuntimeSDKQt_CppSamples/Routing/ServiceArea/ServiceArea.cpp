@@ -20,6 +20,7 @@
 
 #include "ServiceArea.h"
 
+#include "GeometryEngine.h"
 #include "Map.h"
 #include "MapQuickView.h"
 #include "PictureMarkerSymbol.h"
@@ -29,16 +30,61 @@
 #include "SimpleLineSymbol.h"
 #include "SimpleRenderer.h"
 
+#include <QMap>
+#include <QPair>
+#include <QRunnable>
+
 using namespace Esri::ArcGISRuntime;
 
+namespace
+{
+  struct AreaPolygon
+  {
+    Geometry geometry;
+    double fromCutoff = 0.0;
+    double toCutoff = 0.0;
+  };
+
+  // Returns the geometries to display, optionally unioning the polygons of all
+  // facilities that share the same impedance cutoff band into one geometry.
+  // Only works on geometry values, so this is safe to run off the UI thread.
+  QList<Geometry> buildAreaGeometries(const QList<AreaPolygon>& polygons, bool dissolveByCutoff)
+  {
+    QList<Geometry> geometries;
+    if (!dissolveByCutoff)
+    {
+      geometries.reserve(polygons.size());
+      for (const AreaPolygon& polygon : polygons)
+        geometries.append(polygon.geometry);
+
+      return geometries;
+    }
+
+    QMap<QPair<double, double>, QList<Geometry>> bands;
+    for (const AreaPolygon& polygon : polygons)
+      bands[qMakePair(polygon.fromCutoff, polygon.toCutoff)].append(polygon.geometry);
+
+    geometries.reserve(bands.size());
+    for (auto it = bands.cbegin(); it != bands.cend(); ++it)
+      geometries.append(it.value().size() == 1 ? it.value().first() : GeometryEngine::unionOf(it.value()));
+
+    return geometries;
+  }
+}
+
 ServiceArea::ServiceArea(QQuickItem* parent /* = nullptr */):
   QQuickItem(parent),
   m_task(new ServiceAreaTask(
            QUrl("https://sampleserver6.arcgisonline.com/arcgis/rest/services/NetworkAnalysis/SanDiego/NAServer/ServiceArea"), this))
 {
+  // area geometries are built one solve at a time
+  m_buildPool.setMaxThreadCount(1);
 }
 
-ServiceArea::~ServiceArea() = default;
+ServiceArea::~ServiceArea()
+{
+  m_buildPool.waitForDone();
+}
 
 void ServiceArea::init()
 {
@@ -74,6 +120,17 @@ void ServiceArea::componentComplete()
   m_task->load();
 
   setupGraphics();
+
+  // the solve is complete once the map view has drawn the new service areas
+  connect(m_mapView, &MapQuickView::drawStatusChanged, this, [this](DrawStatus drawStatus)
+  {
+    if (!m_awaitingRender || drawStatus != DrawStatus::Completed)
+      return;
+
+    m_awaitingRender = false;
+    m_renderLatency = m_solveTimer.elapsed();
+    emit latencyChanged();
+  });
 }
 
 void ServiceArea::setFacilityMode()
@@ -134,7 +191,12 @@ void ServiceArea::solveServiceArea()
   if (!barriers.isEmpty())
     m_parameters.setPolylineBarriers(barriers);
 
-  m_task->solveServiceArea(m_parameters);
+  // the id is taken now, so that a reset or a newer solve supersedes this one
+  // even while it is still running on the service
+  m_awaitingRender = false;
+  m_solveTimer.start();
+  const TaskWatcher watcher = m_task->solveServiceArea(m_parameters);
+  m_pendingSolves.insert(watcher.taskId(), PendingSolve{++m_solveId, watcher});
 }
 
 void ServiceArea::reset()
@@ -146,6 +208,9 @@ void ServiceArea::reset()
     delete m_barrierBuilder;
     m_barrierBuilder = new PolylineBuilder(SpatialReference::webMercator(), this);
   }
+  // the area graphics stay in m_areaGraphics for the next solve
+  ++m_solveId;
+  m_awaitingRender = false;
   m_areasOverlay->graphics()->clear();
   if (m_graphicParent)
   {
@@ -168,6 +233,35 @@ void ServiceArea::newBarrier()
   m_barrierOverlay->graphics()->append(new Graphic(m_barrierBuilder->toPolyline(), m_graphicParent));
 }
 
+bool ServiceArea::dissolveByCutoff() const
+{
+  return m_dissolveByCutoff;
+}
+
+void ServiceArea::setDissolveByCutoff(bool dissolve)
+{
+  if (m_dissolveByCutoff == dissolve)
+    return;
+
+  m_dissolveByCutoff = dissolve;
+  emit dissolveByCutoffChanged();
+}
+
+int ServiceArea::areaCount() const
+{
+  return m_areasOverlay ? m_areasOverlay->graphics()->size() : 0;
+}
+
+qint64 ServiceArea::solveTime() const
+{
+  return m_solveTime;
+}
+
+qint64 ServiceArea::renderLatency() const
+{
+  return m_renderLatency;
+}
+
 bool ServiceArea::busy() const
 {
   return m_busy;
@@ -236,24 +330,67 @@ void ServiceArea::setupRouting()
   });
 
   connect(m_task, &ServiceAreaTask::solveServiceAreaCompleted, this, [this]
-          (QUuid, Esri::ArcGISRuntime::ServiceAreaResult serviceAreaResult)
+          (QUuid taskId, Esri::ArcGISRuntime::ServiceAreaResult serviceAreaResult)
   {
-    setBusy(false);
+    // a newer solve or a reset has superseded this one
+    const int solveId = m_pendingSolves.take(taskId).solveId;
+    if (solveId != m_solveId)
+      return;
+
+    m_solveTime = m_solveTimer.elapsed();
+
     if (serviceAreaResult.isEmpty())
     {
+      setBusy(false);
       m_message = "No Serice Areas calculated!";
       emit messageChanged();
+      return;
     }
 
-    int numFacilities = m_facilitiesOverlay->graphics()->size();
+    // only copy the polygon values here; the geometry work happens on the build pool
+    QList<AreaPolygon> polygons;
+    const int numFacilities = m_facilitiesOverlay->graphics()->size();
     for (int i = 0; i < numFacilities; ++i)
     {
-      QList<ServiceAreaPolygon> results = serviceAreaResult.resultPolygons(i);
-      if (!m_graphicParent)
-        m_graphicParent = new QObject(this);
+      const QList<ServiceAreaPolygon> results = serviceAreaResult.resultPolygons(i);
       for (const ServiceAreaPolygon& poly : results)
-        m_areasOverlay->graphics()->append(new Graphic(poly.geometry(), m_graphicParent));
+        polygons.append(AreaPolygon{poly.geometry(), poly.fromImpedanceCutoff(), poly.toImpedanceCutoff()});
     }
+
+    const bool dissolve = m_dissolveByCutoff;
+    m_buildPool.start(QRunnable::create([this, solveId, polygons, dissolve]()
+    {
+      const QList<Geometry> geometries = buildAreaGeometries(polygons, dissolve);
+      QMetaObject::invokeMethod(this, [this, solveId, geometries]()
+      {
+        applyAreaGeometries(solveId, geometries);
+      }, Qt::QueuedConnection);
+    }));
+  });
+
+  // the error does not name its task; a failed solve is done without having
+  // completed, so it is still pending and is forgotten here
+  connect(m_task, &ServiceAreaTask::errorOccurred, this, [this](Esri::ArcGISRuntime::Error error)
+  {
+    bool currentSolveFailed = false;
+    for (auto it = m_pendingSolves.begin(); it != m_pendingSolves.end();)
+    {
+      if (!it->watcher.isDone())
+      {
+        ++it;
+        continue;
+      }
+
+      currentSolveFailed = currentSolveFailed || it->solveId == m_solveId;
+      it = m_pendingSolves.erase(it);
+    }
+
+    if (!currentSolveFailed)
+      return;
+
+    setBusy(false);
+    m_message = error.message();
+    emit messageChanged();
   });
 
   connect(m_mapView, &MapQuickView::mouseClicked, this, [this](QMouseEvent& mouseEvent)
@@ -285,6 +422,41 @@ void ServiceArea::setupRouting()
   m_task->createDefaultParameters();
 }
 
+// Shows the geometries in the areas overlay, reusing the graphics from earlier
+// solves and adding or removing graphics in one batch.
+void ServiceArea::applyAreaGeometries(int solveId, const QList<Geometry>& geometries)
+{
+  // a newer solve or a reset has superseded this one
+  if (solveId != m_solveId)
+    return;
+
+  GraphicListModel* areaGraphics = m_areasOverlay->graphics();
+  const int shownCount = areaGraphics->size();
+  const int count = geometries.size();
+
+  for (int i = 0; i < count; ++i)
+  {
+    if (i < m_areaGraphics.size())
+      m_areaGraphics.at(i)->setGeometry(geometries.at(i));
+    else
+      m_areaGraphics.append(new Graphic(geometries.at(i), this));
+  }
+
+  if (count > shownCount)
+  {
+    areaGraphics->append(m_areaGraphics.mid(shownCount, count - shownCount));
+  }
+  else
+  {
+    for (int i = shownCount - 1; i >= count; --i)
+      areaGraphics->removeAt(i);
+  }
+
+  m_awaitingRender = true;
+  setBusy(false);
+  emit latencyChanged();
+}
+
 void ServiceArea::handleFacilityPoint(const Point &p)
 {
   if (!m_graphicParent)
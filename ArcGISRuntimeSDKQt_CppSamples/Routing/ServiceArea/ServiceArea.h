@@ -21,6 +21,8 @@ namespace Esri
 {
   namespace ArcGISRuntime
   {
+    class Geometry;
+    class Graphic;
     class GraphicsOverlay;
     class Map;
     class MapQuickView;
@@ -31,9 +33,14 @@ namespace Esri
 }
 
 #include "ServiceAreaParameters.h"
+#include "TaskWatcher.h"
 
+#include <QElapsedTimer>
+#include <QHash>
 #include <QList>
 #include <QQuickItem>
+#include <QThreadPool>
+#include <QUuid>
 
 class ServiceArea : public QQuickItem
 {
@@ -41,6 +48,10 @@ class ServiceArea : public QQuickItem
 
   Q_PROPERTY(bool busy READ busy NOTIFY busyChanged)
   Q_PROPERTY(QString message READ message NOTIFY messageChanged)
+  Q_PROPERTY(bool dissolveByCutoff READ dissolveByCutoff WRITE setDissolveByCutoff NOTIFY dissolveByCutoffChanged)
+  Q_PROPERTY(int areaCount READ areaCount NOTIFY latencyChanged)
+  Q_PROPERTY(qint64 solveTime READ solveTime NOTIFY latencyChanged)
+  Q_PROPERTY(qint64 renderLatency READ renderLatency NOTIFY latencyChanged)
 
 public:
   explicit ServiceArea(QQuickItem* parent = nullptr);
@@ -58,6 +69,8 @@ public:
 signals:
   void busyChanged();
   void messageChanged();
+  void dissolveByCutoffChanged();
+  void latencyChanged();
 
 private:
   enum class SampleMode {
@@ -67,6 +80,11 @@ private:
 
   bool busy() const;
   QString message() const;
+  bool dissolveByCutoff() const;
+  void setDissolveByCutoff(bool dissolve);
+  int areaCount() const;
+  qint64 solveTime() const;
+  qint64 renderLatency() const;
 
   void setBusy(bool val);
 
@@ -74,6 +92,7 @@ private:
   void setupRouting();
   void handleFacilityPoint(const Esri::ArcGISRuntime::Point& p);
   void handleBarrierPoint(const Esri::ArcGISRuntime::Point& p);
+  void applyAreaGeometries(int solveId, const QList<Esri::ArcGISRuntime::Geometry>& geometries);
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
@@ -87,6 +106,22 @@ private:
   QString m_message;
   SampleMode m_mode = SampleMode::Facility;
   QObject* m_graphicParent = nullptr;
+  // service area graphics are kept for reuse by later solves; the overlay shows the first ones
+  QList<Esri::ArcGISRuntime::Graphic*> m_areaGraphics;
+  bool m_dissolveByCutoff = false;
+  int m_solveId = 0;
+  // the solve id and watcher of each solve task still running on the service
+  struct PendingSolve
+  {
+    int solveId = 0;
+    Esri::ArcGISRuntime::TaskWatcher watcher;
+  };
+  QHash<QUuid, PendingSolve> m_pendingSolves;
+  bool m_awaitingRender = false;
+  QElapsedTimer m_solveTimer;
+  qint64 m_solveTime = 0;
+  qint64 m_renderLatency = 0;
+  QThreadPool m_buildPool;
 };
 
 #endif // SERVICEAREA_H
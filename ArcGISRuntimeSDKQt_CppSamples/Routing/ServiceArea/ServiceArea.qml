@@ -65,6 +65,13 @@ ServiceAreaSample {
                     reset();
                 }
             }
+
+            CheckBox {
+                text: "Dissolve by cutoff"
+                enabled: !busy
+                checked: dissolveByCutoff
+                onCheckedChanged: dissolveByCutoff = checked;
+            }
         }
     }
 
@@ -126,6 +133,16 @@ ServiceAreaSample {
         }
     }
 
+    Text {
+        anchors {
+            top: editRow.bottom
+            left: parent.left
+            margins: 24
+        }
+        visible: solveTime > 0
+        text: areaCount + " areas, solved in " + solveTime + " ms, drawn after " + renderLatency + " ms"
+    }
+
     BusyIndicator {
         anchors.centerIn: parent
         running: busy
@@ -43,11 +43,15 @@
 #include "MissionData.h"
 
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFileInfo>
 #include <QStringListModel>
 #include <QDir>
+#include <QTimer>
 #include <QtCore/qglobal.h>
 
+#include <algorithm>
+
 #ifdef Q_OS_IOS
 #include <QStandardPaths>
 #endif // Q_OS_IOS
@@ -88,8 +92,14 @@ Animate3DSymbols::Animate3DSymbols(QQuickItem* parent /* = nullptr */):
                                         QStringLiteral("Pyrenees"),
                                         QStringLiteral("Snowdon")},
                                        this)),
-  m_missionData(new MissionData())
+  m_missionData(new MissionData()),
+  m_playback(m_missionData.get())
 {
+  // drive playback at display rate; the playhead itself advances by wall clock time
+  m_timer = new QTimer(this);
+  m_timer->setTimerType(Qt::PreciseTimer);
+  m_timer->setInterval(16);
+  connect(m_timer, &QTimer::timeout, this, &Animate3DSymbols::animate);
 }
 
 Animate3DSymbols::~Animate3DSymbols() = default;
@@ -164,42 +174,162 @@ void Animate3DSymbols::setMissionFrame(int newFrame)
     return;
 
   m_frame = newFrame;
+
+  // the user scrubbed the mission, so move the playhead to the new frame
+  if (m_playback.frame() != newFrame)
+  {
+    m_playback.seek(newFrame);
+    if (!playing() && missionReady() && m_graphic3d)
+      updateGraphics(m_playback.state());
+  }
+
   emit missionFrameChanged();
 }
 
+void Animate3DSymbols::setPlaying(bool playing)
+{
+  if (!m_timer || m_timer->isActive() == playing)
+    return;
+
+  if (playing)
+  {
+    m_frameClock.start();
+    m_timer->start();
+  }
+  else
+  {
+    m_timer->stop();
+  }
+
+  emit playingChanged();
+}
+
+void Animate3DSymbols::setPlaybackRate(double rate)
+{
+  if (rate < 0.0 || qFuzzyCompare(rate, m_playback.playbackRate()))
+    return;
+
+  m_playback.setPlaybackRate(rate);
+  emit playbackRateChanged();
+}
+
 void Animate3DSymbols::animate()
 {
-  if (!m_missionData)
+  if (!missionReady() || !m_graphic3d || !m_graphic2d)
     return;
 
-  if (missionFrame() < missionSize())
+  // advance by the time since the previous tick rather than by one row, so that
+  // timer jitter and dense tracks do not change the speed of the animation.
+  // The time is read in nanoseconds because restart() only returns milliseconds.
+  m_playback.advance(m_frameClock.nsecsElapsed());
+  m_frameClock.restart();
+
+  QElapsedTimer updateTimer;
+  updateTimer.start();
+  updateGraphics(m_playback.state());
+  recordFrameTime(updateTimer.nsecsElapsed());
+
+  const int frame = m_playback.frame();
+  if (frame != m_frame)
   {
-    // get the data for this stage in the mission
-    const MissionData::DataPoint& dp = m_missionData->dataAt(missionFrame());
+    m_frame = frame;
+    emit missionFrameChanged();
+    emit nextFrameRequested();
+  }
+}
 
-    // move 3D graphic to the new position
-    m_graphic3d->setGeometry(dp.m_pos);
-    // update attribute expressions to immediately update rotation
-    m_graphic3d->attributes()->replaceAttribute(HEADING, dp.m_heading);
-    m_graphic3d->attributes()->replaceAttribute(PITCH, dp.m_pitch);
-    m_graphic3d->attributes()->replaceAttribute(ROLL, dp.m_roll);
+void Animate3DSymbols::updateGraphics(const MissionPlayback::State& state)
+{
+  // build the position once for both views and only push values which changed
+  // since the previous frame, so each graphic is touched at most once per frame.
+  // Either view's graphic may not have been created yet.
+  const bool moved = !qFuzzyCompare(state.m_lon, m_lastState.m_lon) ||
+                     !qFuzzyCompare(state.m_lat, m_lastState.m_lat) ||
+                     !qFuzzyCompare(state.m_elevation, m_lastState.m_elevation);
+  if (moved)
+  {
+    const Point position(state.m_lon, state.m_lat, state.m_elevation, SpatialReference::wgs84());
+    if (m_graphic3d)
+      m_graphic3d->setGeometry(position);
+    if (m_graphic2d)
+      m_graphic2d->setGeometry(position);
+  }
 
-    // move 2D graphic to the new position
-    m_graphic2d->setGeometry(dp.m_pos);
-    m_symbol2d->setAngle(dp.m_heading);
+  // update attribute expressions to immediately update rotation
+  if (!qFuzzyCompare(state.m_heading, m_lastState.m_heading))
+  {
+    if (m_graphic3d)
+      m_graphic3d->attributes()->replaceAttribute(HEADING, state.m_heading);
+    if (m_symbol2d)
+      m_symbol2d->setAngle(state.m_heading);
   }
 
-  // increment the frame count
-  emit nextFrameRequested();
+  if (m_graphic3d && !qFuzzyCompare(state.m_pitch, m_lastState.m_pitch))
+    m_graphic3d->attributes()->replaceAttribute(PITCH, state.m_pitch);
+
+  if (m_graphic3d && !qFuzzyCompare(state.m_roll, m_lastState.m_roll))
+    m_graphic3d->attributes()->replaceAttribute(ROLL, state.m_roll);
+
+  m_lastState = state;
+}
+
+void Animate3DSymbols::recordFrameTime(qint64 updateNs)
+{
+  constexpr int framesPerWindow = 60;
+
+  m_windowUpdateNs += updateNs;
+  m_windowMaxUpdateNs = std::max(m_windowMaxUpdateNs, updateNs);
+  if (++m_windowFrames < framesPerWindow)
+    return;
+
+  // report once per window rather than per frame to keep QML bindings quiet
+  m_frameUpdateTime = m_windowUpdateNs / (m_windowFrames * 1.0e6);
+  m_maxFrameUpdateTime = m_windowMaxUpdateNs / 1.0e6;
+  m_windowUpdateNs = 0;
+  m_windowMaxUpdateNs = 0;
+  m_windowFrames = 0;
+
+  emit frameStatisticsChanged();
 }
 
 void Animate3DSymbols::changeMission(const QString &missionNameStr)
 {
   setMissionFrame(0);
+  m_playback.seek(0);
 
-  // read the mission data from the samples .csv files
+  // read the mission data from the samples .csv files. The first time a mission
+  // is selected it is converted to the binary .mission format next to the .csv
+  // so that subsequent loads only need to memory map the file
   QString formattedname = missionNameStr;
-  m_missionData->parse(m_dataPath + "/Missions/" + formattedname.remove(" ") + ".csv");
+  const QString missionPath = m_dataPath + "/Missions/" + formattedname.remove(" ");
+  const QString csvPath = missionPath + ".csv";
+  const QString binaryPath = missionPath + ".mission";
+
+  // the .csv is parsed on every load, both as the baseline that the load is
+  // compared against and to convert it when the .mission file is missing or stale
+  {
+    MissionData csvData;
+    QElapsedTimer parseTimer;
+    parseTimer.start();
+    const bool parsed = csvData.parse(csvPath);
+    m_csvLoadTime = parsed ? parseTimer.nsecsElapsed() / 1.0e6 : -1.0;
+    m_csvDataBytes = csvData.dataBytes();
+    m_csvPeakBytes = csvData.peakBytes();
+
+    if (parsed && (!QFileInfo::exists(binaryPath) ||
+                   QFileInfo(binaryPath).lastModified() < QFileInfo(csvPath).lastModified()))
+    {
+      csvData.save(binaryPath);
+    }
+  }
+
+  QElapsedTimer loadTimer;
+  loadTimer.start();
+  if (!m_missionData->load(binaryPath))
+    m_missionData->parse(csvPath);
+
+  m_loadTime = loadTimer.nsecsElapsed() / 1.0e6;
+  emit loadStatisticsChanged();
 
   // if the mission was loaded successfully, move to the start position
   if (missionReady() && m_routeGraphic)
@@ -208,8 +338,9 @@ void Animate3DSymbols::changeMission(const QString &missionNameStr)
     PolylineBuilder* routeBldr = new PolylineBuilder(SpatialReference::wgs84(), this);
     for (int i = 0; i < missionSize(); ++i)
     {
-      const MissionData::DataPoint& dp = m_missionData->dataAt(i);
-      routeBldr->addPoint(dp.m_pos);
+      routeBldr->addPoint(m_missionData->valueAt(MissionData::Longitude, i),
+                          m_missionData->valueAt(MissionData::Latitude, i),
+                          m_missionData->valueAt(MissionData::Elevation, i));
     }
 
     // set the polyline as a graphic on the mapView
@@ -217,6 +348,10 @@ void Animate3DSymbols::changeMission(const QString &missionNameStr)
 
     m_mapView->setViewpointAndWait(Viewpoint(m_routeGraphic->geometry()));
     createGraphic3D();
+
+    // force both graphics to the start of the new mission
+    m_lastState = MissionPlayback::State();
+    updateGraphics(m_playback.state());
   }
 
   emit missionReadyChanged();
@@ -252,14 +387,14 @@ void Animate3DSymbols::createModel2d(GraphicsOverlay* mapOverlay)
     return;
 
   // get the mission data for the frame
-  const MissionData::DataPoint& dp = m_missionData->dataAt(missionFrame());
+  const MissionData::DataPoint dp = m_missionData->dataAt(missionFrame());
 
   // create a blue triangle symbol to represent the plane on the mini map
   m_symbol2d = new SimpleMarkerSymbol(SimpleMarkerSymbolStyle::Triangle, Qt::blue, 10, this);
   m_symbol2d->setAngle(dp.m_heading);
 
   // create a graphic with the symbol
-  m_graphic2d = new Graphic(dp.m_pos, m_symbol2d, this);
+  m_graphic2d = new Graphic(dp.position(), m_symbol2d, this);
 
   mapOverlay->graphics()->append(m_graphic2d);
 }
@@ -283,12 +418,12 @@ void Animate3DSymbols::createGraphic3D()
     m_model3d = new ModelSceneSymbol(QUrl(m_dataPath + "/Bristol/Collada/Bristol.dae"), 10.0f, this);
 
   // get the mission data for the frame
-  const MissionData::DataPoint& dp = m_missionData->dataAt(missionFrame());
+  const MissionData::DataPoint dp = m_missionData->dataAt(missionFrame());
 
   if (!m_graphic3d)
   {
     // create a graphic using the model symbol
-    m_graphic3d = new Graphic(dp.m_pos, m_model3d, this);
+    m_graphic3d = new Graphic(dp.position(), m_model3d, this);
     m_graphic3d->attributes()->insertAttribute(HEADING, dp.m_heading);
     m_graphic3d->attributes()->insertAttribute(PITCH, dp.m_pitch);
     m_graphic3d->attributes()->insertAttribute(ROLL, dp.m_roll);
@@ -303,7 +438,7 @@ void Animate3DSymbols::createGraphic3D()
   else
   {
     // update existing graphic's geometry and attributes
-    m_graphic3d->setGeometry(dp.m_pos);
+    m_graphic3d->setGeometry(dp.position());
     m_graphic3d->attributes()->replaceAttribute(HEADING, dp.m_heading);
     m_graphic3d->attributes()->replaceAttribute(PITCH, dp.m_pitch);
     m_graphic3d->attributes()->replaceAttribute(ROLL, dp.m_roll);
@@ -371,6 +506,48 @@ int Animate3DSymbols::missionFrame() const
   return m_frame;
 }
 
+bool Animate3DSymbols::playing() const
+{
+  return m_timer && m_timer->isActive();
+}
+
+double Animate3DSymbols::playbackRate() const
+{
+  return m_playback.playbackRate();
+}
+
+double Animate3DSymbols::frameUpdateTime() const
+{
+  return m_frameUpdateTime;
+}
+
+double Animate3DSymbols::maxFrameUpdateTime() const
+{
+  return m_maxFrameUpdateTime;
+}
+
+QString Animate3DSymbols::loadStatistics() const
+{
+  if (!missionReady())
+    return QString();
+
+  const bool mapped = m_missionData->isMapped();
+  const QString load = QString("%1 load: %2 ms, %3 KB %4, %5 KB peak")
+      .arg(mapped ? "Mapped" : "CSV")
+      .arg(m_loadTime, 0, 'f', 2)
+      .arg(m_missionData->dataBytes() / 1024)
+      .arg(mapped ? "mapped" : "heap")
+      .arg(m_missionData->peakBytes() / 1024);
+
+  if (m_csvLoadTime < 0.0)
+    return load + "\nCSV parse: failed";
+
+  return load + QString("\nCSV parse: %1 ms, %2 KB heap, %3 KB peak")
+      .arg(m_csvLoadTime, 0, 'f', 2)
+      .arg(m_csvDataBytes / 1024)
+      .arg(m_csvPeakBytes / 1024);
+}
+
 double Animate3DSymbols::zoom() const
 {
   return m_followingController ? m_followingController->cameraDistance() : 200.0;
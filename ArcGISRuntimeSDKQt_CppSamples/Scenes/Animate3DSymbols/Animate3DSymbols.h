@@ -35,8 +35,12 @@ namespace Esri
 }
 
 class QAbstractListModel;
+class QTimer;
 class MissionData;
 
+#include "MissionPlayback.h"
+
+#include <QElapsedTimer>
 #include <QQuickItem>
 #include <QString>
 
@@ -47,6 +51,11 @@ class Animate3DSymbols : public QQuickItem
   Q_PROPERTY(bool missionReady READ missionReady NOTIFY missionReadyChanged)
   Q_PROPERTY(int missionSize READ missionSize NOTIFY missionSizeChanged)
   Q_PROPERTY(int missionFrame READ missionFrame WRITE setMissionFrame NOTIFY missionFrameChanged)
+  Q_PROPERTY(bool playing READ playing WRITE setPlaying NOTIFY playingChanged)
+  Q_PROPERTY(double playbackRate READ playbackRate WRITE setPlaybackRate NOTIFY playbackRateChanged)
+  Q_PROPERTY(double frameUpdateTime READ frameUpdateTime NOTIFY frameStatisticsChanged)
+  Q_PROPERTY(double maxFrameUpdateTime READ maxFrameUpdateTime NOTIFY frameStatisticsChanged)
+  Q_PROPERTY(QString loadStatistics READ loadStatistics NOTIFY loadStatisticsChanged)
   Q_PROPERTY(QAbstractListModel* missionsModel READ missionsModel CONSTANT)
   Q_PROPERTY(double minZoom READ minZoom NOTIFY minZoomChanged)
   Q_PROPERTY(double zoom READ zoom WRITE setZoom NOTIFY zoomChanged)
@@ -60,7 +69,6 @@ public:
   void componentComplete() override;
   static void init();
 
-  Q_INVOKABLE void animate();
   Q_INVOKABLE void changeMission(const QString& missionName);
   QAbstractListModel* missionsModel();
   Q_INVOKABLE void zoomMapIn();
@@ -71,6 +79,11 @@ public:
   bool missionReady() const;
   int missionSize() const;
   int missionFrame() const;
+  bool playing() const;
+  double playbackRate() const;
+  double frameUpdateTime() const;
+  double maxFrameUpdateTime() const;
+  QString loadStatistics() const;
   double zoom() const;
   double angle() const;
   double minZoom() const;
@@ -78,7 +91,8 @@ public:
   void setMissionFrame(int newFrame);
   void setZoom(double zoomDist);
   void setAngle(double angle);
-  void setSpeed(int intervalMs);
+  void setPlaying(bool playing);
+  void setPlaybackRate(double rate);
 
 signals:
   void missionReadyChanged();
@@ -88,11 +102,18 @@ signals:
   void zoomChanged();
   void angleChanged();
   void missionFrameChanged();
+  void playingChanged();
+  void playbackRateChanged();
+  void frameStatisticsChanged();
+  void loadStatisticsChanged();
 
 private:
   void createModel2d(Esri::ArcGISRuntime::GraphicsOverlay* mapOverlay);
   void createRoute2d(Esri::ArcGISRuntime::GraphicsOverlay* mapOverlay);
   void createGraphic3D();
+  void animate();
+  void updateGraphics(const MissionPlayback::State& state);
+  void recordFrameTime(qint64 updateNs);
 
   static const QString HEADING;
   static const QString ROLL;
@@ -111,6 +132,19 @@ private:
   QString m_dataPath;
   QAbstractListModel* m_missionsModel = nullptr;
   std::unique_ptr<MissionData> m_missionData;
+  MissionPlayback m_playback;
+  MissionPlayback::State m_lastState;
+  QTimer* m_timer = nullptr;
+  QElapsedTimer m_frameClock;
+  qint64 m_windowUpdateNs = 0;
+  qint64 m_windowMaxUpdateNs = 0;
+  int m_windowFrames = 0;
+  double m_frameUpdateTime = 0.0;
+  double m_maxFrameUpdateTime = 0.0;
+  double m_loadTime = 0.0;
+  double m_csvLoadTime = -1.0;
+  qint64 m_csvDataBytes = 0;
+  qint64 m_csvPeakBytes = 0;
   int m_frame = 0;
   double m_mapZoomFactor = 5.0;
 };
@@ -32,9 +32,9 @@ TARGET = Animate3DSymbols
 
 #-------------------------------------------------------------------------------
 
-HEADERS += Animate3DSymbols.h MissionData.h
+HEADERS += Animate3DSymbols.h MissionData.h MissionPlayback.h
 
-SOURCES += main.cpp Animate3DSymbols.cpp MissionData.cpp
+SOURCES += main.cpp Animate3DSymbols.cpp MissionData.cpp MissionPlayback.cpp
 
 RESOURCES += Animate3DSymbols.qrc
 
@@ -27,12 +27,10 @@ Animate3DSymbolsSample {
     missionFrame: progressSlider.value
     zoom: cameraDistance.value
     angle: cameraAngle.value
+    playing: playButton.checked
+    playbackRate: animationSpeed.value / 50.0
 
-    onNextFrameRequested: {
-        progressSlider.value = progressSlider.value + 1;
-        if (progressSlider.value >= missionSize)
-            progressSlider.value = 0;
-    }
+    onNextFrameRequested: progressSlider.value = missionFrame;
 
     Component.onCompleted: {
         missionList.currentIndex = 0;
@@ -144,6 +142,19 @@ Animate3DSymbolsSample {
                 text: "speed"
             }
 
+            Label {
+                Layout.columnSpan: 2
+                Layout.alignment: Qt.AlignLeft | Qt.AlignBottom
+                Layout.fillHeight: true
+                verticalAlignment: Text.AlignBottom
+                text: loadStatistics + (playing ? "\nFrame update: %1 ms average, %2 ms max"
+                                                  .arg(frameUpdateTime.toFixed(3))
+                                                  .arg(maxFrameUpdateTime.toFixed(3)) : "")
+                color: "white"
+                style: Text.Outline
+                styleColor: "black"
+            }
+
             Rectangle {
                 id: mapFrame
                 Layout.columnSpan: 2
@@ -217,12 +228,4 @@ Animate3DSymbolsSample {
             }
         }
     }
-
-    Timer {
-        id: timer
-        interval: 16.0 + 84 * (animationSpeed.to - animationSpeed.value) / 100.0;
-        running: playButton.checked;
-        repeat: true
-        onTriggered: animate();
-    }
 }
@@ -20,7 +20,28 @@
 
 #include "MissionData.h"
 
-#include <QFile>
+#include <QSaveFile>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace
+{
+  // layout of a .mission file: a 16 byte header followed by ColumnCount
+  // contiguous arrays of size() native endian doubles
+  struct MissionHeader
+  {
+    char magic[4];
+    quint32 version;
+    quint64 count;
+  };
+
+  constexpr char missionMagic[4] = {'M', 'S', 'N', 'B'};
+  constexpr quint32 missionVersion = 1;
+
+  static_assert(sizeof(MissionHeader) == 16, "MissionHeader must keep the columns 8 byte aligned");
+} // namespace
 
 // MissionData
 
@@ -29,12 +50,33 @@ MissionData::MissionData():
 {
 }
 
-MissionData::~MissionData() = default;
+MissionData::~MissionData()
+{
+  reset();
+}
 
-bool MissionData::parse(const QString& dataPath)
+void MissionData::reset()
 {
-  m_data.clear();
+  if (m_map)
+  {
+    m_file.unmap(m_map);
+    m_map = nullptr;
+  }
+
+  if (m_file.isOpen())
+    m_file.close();
+
+  m_buffer.clear();
+  m_buffer.shrink_to_fit();
+  std::fill(std::begin(m_columns), std::end(m_columns), nullptr);
+  m_size = 0;
+  m_peakBytes = 0;
   m_ready = false;
+}
+
+bool MissionData::parse(const QString& dataPath)
+{
+  reset();
 
   QFile file(dataPath);
   if(!file.exists())
@@ -43,50 +85,147 @@ bool MissionData::parse(const QString& dataPath)
   if (!file.open(QIODevice::ReadOnly))
     return false;
 
+  std::vector<std::array<double, ColumnCount>> rows;
+  rows.reserve(static_cast<size_t>(file.size() / 64));
+
   while (!file.atEnd())
   {
     QByteArray line = file.readLine();
     QList<QByteArray> parts = line.split(',');
-    if(parts.size() < 6)
+    if(parts.size() < ColumnCount)
       continue;
 
-    bool ok = false;
-    double lon = parts.at(0).toDouble(&ok);
-    if(!ok)
-      continue;
+    std::array<double, ColumnCount> row;
+    bool ok = true;
+    for (int column = 0; column < ColumnCount && ok; ++column)
+      row[column] = parts.at(column).simplified().toDouble(&ok);
 
-    double lat = parts.at(1).toDouble(&ok);
     if(!ok)
       continue;
 
-    double elevation = parts.at(2).toDouble(&ok);
-    if(!ok)
-      continue;
+    rows.push_back(row);
+  }
 
-    double heading = parts.at(3).toDouble(&ok);
-    if(!ok)
-      continue;
+  // transpose the rows into one contiguous array per column
+  m_size = rows.size();
+  m_buffer.resize(m_size * ColumnCount);
+  for (int column = 0; column < ColumnCount; ++column)
+  {
+    double* dest = m_buffer.data() + column * m_size;
+    for (size_t i = 0; i < m_size; ++i)
+      dest[i] = rows[i][column];
 
-    double pitch = parts.at(4).toDouble(&ok);
-    if(!ok)
-      continue;
+    m_columns[column] = dest;
+  }
 
-    double roll = parts.at(5).simplified().toDouble(&ok);
-    if(!ok)
-      continue;
+  // the rows and the columns are both held until the rows go out of scope
+  m_peakBytes = static_cast<qint64>(rows.capacity() * sizeof(std::array<double, ColumnCount>) +
+                                    m_buffer.capacity() * sizeof(double));
+
+  m_ready = m_size > 0;
+  return m_ready;
+}
+
+bool MissionData::load(const QString& binaryPath)
+{
+  reset();
 
-    m_data.emplace_back((double)lon, (double)lat, (double)elevation, (double)heading, (double)pitch, (double)roll);
+  m_file.setFileName(binaryPath);
+  if (!m_file.open(QIODevice::ReadOnly))
+    return false;
+
+  if (m_file.size() < static_cast<qint64>(sizeof(MissionHeader)))
+  {
+    reset();
+    return false;
+  }
+
+  m_map = m_file.map(0, m_file.size());
+  if (!m_map)
+  {
+    reset();
+    return false;
+  }
+
+  MissionHeader header;
+  std::memcpy(&header, m_map, sizeof(MissionHeader));
+
+  const qint64 expectedSize = static_cast<qint64>(sizeof(MissionHeader) + header.count * ColumnCount * sizeof(double));
+  if (std::memcmp(header.magic, missionMagic, sizeof(missionMagic)) != 0 ||
+      header.version != missionVersion ||
+      m_file.size() != expectedSize)
+  {
+    reset();
+    return false;
   }
 
-  m_ready = m_data.size() > 0;
+  // the columns point straight into the mapped file, no values are copied
+  m_size = static_cast<size_t>(header.count);
+  const double* values = reinterpret_cast<const double*>(m_map + sizeof(MissionHeader));
+  for (int column = 0; column < ColumnCount; ++column)
+    m_columns[column] = values + column * m_size;
+
+  m_peakBytes = m_file.size();
+  m_ready = m_size > 0;
   return m_ready;
 }
 
-const MissionData::DataPoint& MissionData::dataAt(size_t i) const
+bool MissionData::convert(const QString& csvPath, const QString& binaryPath)
+{
+  MissionData data;
+  return data.parse(csvPath) && data.save(binaryPath);
+}
+
+bool MissionData::save(const QString& binaryPath) const
+{
+  if (!m_ready)
+    return false;
+
+  QSaveFile file(binaryPath);
+  if (!file.open(QIODevice::WriteOnly))
+    return false;
+
+  MissionHeader header;
+  std::memcpy(header.magic, missionMagic, sizeof(missionMagic));
+  header.version = missionVersion;
+  header.count = m_size;
+
+  // a mapped mission is written from its columns, a parsed one from its buffer
+  file.write(reinterpret_cast<const char*>(&header), sizeof(MissionHeader));
+  for (int column = 0; column < ColumnCount; ++column)
+    file.write(reinterpret_cast<const char*>(m_columns[column]), static_cast<qint64>(m_size * sizeof(double)));
+
+  return file.commit();
+}
+
+MissionData::DataPoint MissionData::dataAt(size_t i) const
+{
+  DataPoint dp;
+  if(i < m_size)
+  {
+    dp.m_lon = m_columns[Longitude][i];
+    dp.m_lat = m_columns[Latitude][i];
+    dp.m_elevation = m_columns[Elevation][i];
+    dp.m_heading = m_columns[Heading][i];
+    dp.m_pitch = m_columns[Pitch][i];
+    dp.m_roll = m_columns[Roll][i];
+  }
+
+  return dp;
+}
+
+double MissionData::valueAt(Column column, size_t i) const
+{
+  if (column < 0 || column >= ColumnCount || i >= m_size)
+    return NAN;
+
+  return m_columns[column][i];
+}
+
+qint64 MissionData::dataBytes() const
 {
-  if(i < m_data.size())
-    return m_data[i];
+  if (m_map)
+    return m_file.size();
 
-  static MissionData::DataPoint dataPoint;
-  return dataPoint;
+  return static_cast<qint64>(m_buffer.capacity() * sizeof(double));
 }
@@ -19,41 +19,79 @@
 // C++ API headers
 #include "Point.h"
 
+// Qt headers
+#include <QFile>
+
 // STL headers
 #include <cmath>
+#include <vector>
 
 class MissionData
 {
 public:
 
+  // plain values, so reading a row allocates nothing; the Point is only
+  // built by callers which need one
   struct DataPoint
   {
-    DataPoint(){}
-    DataPoint(double lon, double lat, double elevation, double heading, double pitch, double roll):
-      m_pos(Esri::ArcGISRuntime::Point(lon, lat, elevation, Esri::ArcGISRuntime::SpatialReference::wgs84())),
-      m_heading(heading),
-      m_pitch(pitch),
-      m_roll(roll){}
-
-    Esri::ArcGISRuntime::Point m_pos;
+    Esri::ArcGISRuntime::Point position() const
+    {
+      return Esri::ArcGISRuntime::Point(m_lon, m_lat, m_elevation, Esri::ArcGISRuntime::SpatialReference::wgs84());
+    }
+
+    double m_lon = NAN;
+    double m_lat = NAN;
+    double m_elevation = NAN;
     double m_heading = NAN;
     double m_pitch = NAN;
     double m_roll = NAN;
   };
 
-  typedef std::vector<DataPoint> DataPointList;
+  // the mission values are stored column by column so that the binary
+  // format can be memory mapped and read without any per row parsing
+  enum Column
+  {
+    Longitude = 0,
+    Latitude,
+    Elevation,
+    Heading,
+    Pitch,
+    Roll,
+    ColumnCount
+  };
 
   MissionData();
   ~MissionData();
 
   bool parse(const QString& dataPath);
-  bool isEmpty() const {return m_data.empty();}
-  size_t size() const {return m_data.size();}
-  const DataPoint& dataAt(size_t i) const;
+  bool load(const QString& binaryPath);
+  bool save(const QString& binaryPath) const;
+  static bool convert(const QString& csvPath, const QString& binaryPath);
+
+  bool isEmpty() const {return m_size == 0;}
+  size_t size() const {return m_size;}
+  DataPoint dataAt(size_t i) const;
+  double valueAt(Column column, size_t i) const;
   bool ready() const {return m_ready;}
+  bool isMapped() const {return m_map != nullptr;}
+  // bytes holding the values once read: the heap buffer of a parsed .csv
+  // file or the mapped length of a .mission file
+  qint64 dataBytes() const;
+  // the most bytes held at once while reading, which for a .csv file
+  // includes the rows collected before they are transposed
+  qint64 peakBytes() const {return m_peakBytes;}
 
 private:
-  DataPointList m_data;
+  void reset();
+
+  // columnar copy of the values when parsed from a .csv file
+  std::vector<double> m_buffer;
+  // memory mapped .mission file
+  QFile m_file;
+  uchar* m_map = nullptr;
+  const double* m_columns[ColumnCount] = {};
+  size_t m_size = 0;
+  qint64 m_peakBytes = 0;
   bool m_ready;
 };
 
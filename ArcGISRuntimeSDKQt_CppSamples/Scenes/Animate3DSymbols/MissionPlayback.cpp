@@ -0,0 +1,116 @@
+// [WriteFile Name=Animate3DSymbols, Category=Scenes]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "MissionPlayback.h"
+
+#include "MissionData.h"
+
+#include <cmath>
+
+namespace
+{
+  double lerp(double from, double to, double t)
+  {
+    return from + (to - from) * t;
+  }
+
+  // interpolate along the shortest arc so that e.g. 350 -> 10 degrees
+  // turns through north instead of sweeping back through 180
+  double lerpAngle(double from, double to, double t)
+  {
+    return from + std::remainder(to - from, 360.0) * t;
+  }
+} // namespace
+
+// MissionPlayback
+
+MissionPlayback::MissionPlayback(const MissionData* missionData):
+  m_missionData(missionData)
+{
+}
+
+MissionPlayback::~MissionPlayback() = default;
+
+void MissionPlayback::setSamplesPerSecond(double samplesPerSecond)
+{
+  if (samplesPerSecond > 0.0)
+    m_samplesPerSecond = samplesPerSecond;
+}
+
+void MissionPlayback::setPlaybackRate(double rate)
+{
+  if (rate >= 0.0)
+    m_playbackRate = rate;
+}
+
+void MissionPlayback::advance(qint64 elapsedNs)
+{
+  if (!m_missionData || m_missionData->isEmpty() || elapsedNs <= 0)
+    return;
+
+  const double elapsedSeconds = elapsedNs / 1.0e9;
+  seek(m_position + elapsedSeconds * m_samplesPerSecond * m_playbackRate);
+}
+
+void MissionPlayback::seek(double position)
+{
+  if (!m_missionData || m_missionData->isEmpty())
+  {
+    m_position = 0.0;
+    return;
+  }
+
+  const double size = static_cast<double>(m_missionData->size());
+  m_position = std::fmod(position, size);
+  if (m_position < 0.0)
+    m_position += size;
+}
+
+MissionPlayback::State MissionPlayback::state() const
+{
+  State state;
+  if (!m_missionData || m_missionData->isEmpty())
+    return state;
+
+  const size_t size = m_missionData->size();
+  const size_t from = static_cast<size_t>(m_position);
+  // the last sample is held rather than interpolated towards the first
+  const size_t to = from + 1 < size ? from + 1 : from;
+  const double t = m_position - static_cast<double>(from);
+
+  auto value = [this, from, to, t](MissionData::Column column)
+  {
+    return lerp(m_missionData->valueAt(column, from), m_missionData->valueAt(column, to), t);
+  };
+
+  auto angle = [this, from, to, t](MissionData::Column column)
+  {
+    return lerpAngle(m_missionData->valueAt(column, from), m_missionData->valueAt(column, to), t);
+  };
+
+  state.m_lon = value(MissionData::Longitude);
+  state.m_lat = value(MissionData::Latitude);
+  state.m_elevation = value(MissionData::Elevation);
+  state.m_heading = angle(MissionData::Heading);
+  state.m_pitch = angle(MissionData::Pitch);
+  state.m_roll = angle(MissionData::Roll);
+
+  return state;
+}
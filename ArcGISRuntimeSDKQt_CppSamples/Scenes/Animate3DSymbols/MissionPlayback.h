@@ -0,0 +1,67 @@
+// [WriteFile Name=Animate3DSymbols, Category=Scenes]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+#ifndef MISSIONPLAYBACK_H
+#define MISSIONPLAYBACK_H
+
+#include <QtGlobal>
+
+#include <cmath>
+
+class MissionData;
+
+// Advances a playhead through a MissionData against elapsed wall clock time
+// and interpolates the position and orientation between the recorded samples.
+class MissionPlayback
+{
+public:
+
+  struct State
+  {
+    double m_lon = NAN;
+    double m_lat = NAN;
+    double m_elevation = NAN;
+    double m_heading = NAN;
+    double m_pitch = NAN;
+    double m_roll = NAN;
+  };
+
+  explicit MissionPlayback(const MissionData* missionData);
+  ~MissionPlayback();
+
+  // number of mission samples played per second at a playback rate of 1.0
+  void setSamplesPerSecond(double samplesPerSecond);
+  double samplesPerSecond() const {return m_samplesPerSecond;}
+
+  void setPlaybackRate(double rate);
+  double playbackRate() const {return m_playbackRate;}
+
+  // moves the playhead by the given wall clock time, wrapping at the end
+  // of the mission. Rows that fall entirely within the step are skipped.
+  void advance(qint64 elapsedNs);
+  void seek(double position);
+  double position() const {return m_position;}
+  int frame() const {return static_cast<int>(m_position);}
+
+  State state() const;
+
+private:
+  const MissionData* m_missionData = nullptr;
+  double m_samplesPerSecond = 20.0;
+  double m_playbackRate = 1.0;
+  double m_position = 0.0;
+};
+
+#endif // MISSIONPLAYBACK_H
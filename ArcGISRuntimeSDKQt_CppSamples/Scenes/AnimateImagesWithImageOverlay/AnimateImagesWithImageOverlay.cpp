@@ -20,6 +20,8 @@
 
 #include "AnimateImagesWithImageOverlay.h"
 
+#include "FramePrefetcher.h"
+
 #include "ArcGISTiledElevationSource.h"
 #include "ArcGISTiledLayer.h"
 #include "Scene.h"
@@ -39,8 +41,6 @@
 #include <QtCore/qglobal.h>
 #include <QTimer>
 
-#include <memory>
-
 #ifdef Q_OS_IOS
 #include <QStandardPaths>
 #endif // Q_OS_IOS
@@ -137,6 +137,24 @@ void AnimateImagesWithImageOverlay::setupImageOverlay()
   // append the image overlay to the scene view
   m_sceneView->imageOverlays()->append(m_imageOverlay);
 
+  // decode the images on a thread pool ahead of the animation
+  QStringList imagePaths;
+  imagePaths.reserve(m_imagesSize);
+  for (const QString& image : m_images)
+    imagePaths.append(m_dataPath + "/" + image);
+
+  m_framePrefetcher = new FramePrefetcher(imagePaths, m_pacificSouthwestEnvelope, this);
+
+  // show a frame requested while stopped (e.g. when scrubbing) as soon as it is decoded
+  connect(m_framePrefetcher, &FramePrefetcher::frameDecoded, this, [this](int index)
+  {
+    if (m_isStopped && index == m_index)
+      showFrame(index);
+  });
+
+  // start decoding the first frames before the animation is started
+  m_framePrefetcher->frameAt(m_index);
+
   // Create new Timer and set the timeout interval to 68ms
   m_timer = new QTimer(this);
   m_timer->setInterval(68);
@@ -151,14 +169,13 @@ void AnimateImagesWithImageOverlay::animateImageFrames()
   if (m_imagesSize == 0)
     return;
 
-  // create an image with the given path and use it to create an image frame
-  const QImage image(m_dataPath + "/" + m_images[m_index]);
-
-  // use std::unqiue_ptr to handle the lifetime of the image frame
-  std::unique_ptr<ImageFrame> imageFrame = std::make_unique<ImageFrame>(image, m_pacificSouthwestEnvelope);
-
-  // set image frame to image overlay
-  m_imageOverlay->setImageFrame(imageFrame.get());
+  // the frame has been decoded in the background; if it is not ready yet the
+  // previous frame stays on screen and the frame counts as dropped
+  if (!showFrame(m_index))
+  {
+    ++m_droppedFrames;
+    emit droppedFramesChanged();
+  }
 
   // increment the index to keep track of which image to load next
   m_index++;
@@ -166,6 +183,48 @@ void AnimateImagesWithImageOverlay::animateImageFrames()
   // reset index once all files have been loaded
   if (m_index == m_imagesSize)
     m_index = 0;
+
+  emit frameIndexChanged();
+}
+
+bool AnimateImagesWithImageOverlay::showFrame(int index)
+{
+  if (!m_framePrefetcher || !m_imageOverlay)
+    return false;
+
+  ImageFrame* imageFrame = m_framePrefetcher->frameAt(index);
+  if (!imageFrame)
+    return false;
+
+  // set image frame to image overlay
+  m_imageOverlay->setImageFrame(imageFrame);
+  return true;
+}
+
+int AnimateImagesWithImageOverlay::frameIndex() const
+{
+  return m_index;
+}
+
+void AnimateImagesWithImageOverlay::setFrameIndex(int index)
+{
+  if (index < 0 || index >= m_imagesSize || index == m_index)
+    return;
+
+  // frames around the playhead stay decoded, so scrubbing back does not decode again
+  m_index = index;
+  showFrame(m_index);
+  emit frameIndexChanged();
+}
+
+int AnimateImagesWithImageOverlay::frameCount() const
+{
+  return m_imagesSize;
+}
+
+int AnimateImagesWithImageOverlay::droppedFrames() const
+{
+  return m_droppedFrames;
 }
 
 void AnimateImagesWithImageOverlay::setTimerInterval(int value)
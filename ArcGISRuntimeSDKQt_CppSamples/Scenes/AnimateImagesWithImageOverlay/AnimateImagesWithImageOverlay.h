@@ -32,6 +32,7 @@ class ImageOverlay;
 #include <QObject>
 
 class QTimer;
+class FramePrefetcher;
 
 #include "Envelope.h"
 
@@ -41,6 +42,9 @@ class AnimateImagesWithImageOverlay : public QObject
 
   Q_PROPERTY(Esri::ArcGISRuntime::SceneQuickView* sceneView READ sceneView WRITE setSceneView NOTIFY sceneViewChanged)
   Q_PROPERTY(bool isStopped MEMBER m_isStopped NOTIFY isStoppedChanged)
+  Q_PROPERTY(int frameIndex READ frameIndex WRITE setFrameIndex NOTIFY frameIndexChanged)
+  Q_PROPERTY(int frameCount READ frameCount CONSTANT)
+  Q_PROPERTY(int droppedFrames READ droppedFrames NOTIFY droppedFramesChanged)
 
 public:
   explicit AnimateImagesWithImageOverlay(QObject* parent = nullptr);
@@ -56,6 +60,8 @@ public:
 signals:
   void sceneViewChanged();
   void isStoppedChanged();
+  void frameIndexChanged();
+  void droppedFramesChanged();
 
 private slots:
   void animateImageFrames();
@@ -64,6 +70,11 @@ private:
   Esri::ArcGISRuntime::SceneQuickView* sceneView() const;
   void setSceneView(Esri::ArcGISRuntime::SceneQuickView* sceneView);
   void setupImageOverlay();
+  int frameIndex() const;
+  void setFrameIndex(int index);
+  int frameCount() const;
+  int droppedFrames() const;
+  bool showFrame(int index);
 
   Esri::ArcGISRuntime::Envelope m_pacificSouthwestEnvelope;
   Esri::ArcGISRuntime::ImageOverlay* m_imageOverlay = nullptr;
@@ -71,6 +82,8 @@ private:
   Esri::ArcGISRuntime::SceneQuickView* m_sceneView = nullptr;
 
   int m_index = 0;
+  int m_droppedFrames = 0;
+  FramePrefetcher* m_framePrefetcher = nullptr;
   bool m_isStopped = true;
   QTimer* m_timer = nullptr;
   const QString m_dataPath = "";
@@ -33,11 +33,13 @@ include($$PWD/arcgisruntime.pri)
 #-------------------------------------------------------------------------------
 
 HEADERS += \
-    AnimateImagesWithImageOverlay.h
+    AnimateImagesWithImageOverlay.h \
+    FramePrefetcher.h
 
 SOURCES += \
     main.cpp \
-    AnimateImagesWithImageOverlay.cpp
+    AnimateImagesWithImageOverlay.cpp \
+    FramePrefetcher.cpp
 
 RESOURCES += AnimateImagesWithImageOverlay.qrc
 
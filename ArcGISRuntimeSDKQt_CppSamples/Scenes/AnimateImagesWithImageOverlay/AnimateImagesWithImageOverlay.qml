@@ -114,6 +114,23 @@ Item {
                         }
                     }
                 }
+
+                // scrub through the frames while the animation is stopped
+                Slider {
+                    id: frameSlider
+                    from: 0
+                    to: Math.max(0, model.frameCount - 1)
+                    stepSize: 1
+                    value: model.frameIndex
+                    enabled: model.isStopped
+                    Layout.fillWidth: true
+                    onMoved: model.frameIndex = value;
+                }
+
+                Text {
+                    Layout.alignment: Qt.AlignHCenter
+                    text: "dropped frames: " + model.droppedFrames
+                }
             }
         }
     }
@@ -0,0 +1,155 @@
+// [WriteFile Name=AnimateImagesWithImageOverlay, Category=Scenes]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "FramePrefetcher.h"
+
+#include "ImageFrame.h"
+
+#include <QRunnable>
+
+#include <algorithm>
+
+using namespace Esri::ArcGISRuntime;
+
+FramePrefetcher::FramePrefetcher(const QStringList& imagePaths, const Envelope& extent, QObject* parent /* = nullptr */):
+  QObject(parent),
+  m_imagePaths(imagePaths),
+  m_extent(extent)
+{
+}
+
+FramePrefetcher::~FramePrefetcher()
+{
+  // decodes still running post their results to this object, so wait for them.
+  // Results already posted are discarded together with this object.
+  m_threadPool.clear();
+  m_threadPool.waitForDone();
+}
+
+void FramePrefetcher::setLookahead(int frames)
+{
+  m_lookahead = std::max(1, frames);
+  schedule();
+}
+
+void FramePrefetcher::setMemoryBudget(qint64 bytes)
+{
+  m_memoryBudget = std::max<qint64>(0, bytes);
+  evict();
+  schedule();
+}
+
+ImageFrame* FramePrefetcher::frameAt(int index)
+{
+  if (index < 0 || index >= frameCount())
+    return nullptr;
+
+  m_playhead = index;
+  evict();
+  schedule();
+
+  const auto it = m_frames.find(index);
+  return it != m_frames.end() ? it->second.m_imageFrame.get() : nullptr;
+}
+
+void FramePrefetcher::schedule()
+{
+  const int count = frameCount();
+  if (count == 0)
+    return;
+
+  for (int offset = 0; offset < std::min(m_lookahead, count); ++offset)
+  {
+    const int index = (m_playhead + offset) % count;
+    if (m_frames.count(index) != 0 || m_inFlight.contains(index))
+      continue;
+
+    // once the size of a frame is known, do not decode beyond the budget
+    const qint64 projectedBytes = m_cachedBytes + (m_inFlight.size() + 1) * m_averageFrameBytes;
+    if (offset > 0 && m_averageFrameBytes > 0 && projectedBytes > m_memoryBudget)
+      return;
+
+    m_inFlight.insert(index);
+    const QString path = m_imagePaths.at(index);
+    m_threadPool.start(QRunnable::create([this, index, path]()
+    {
+      // decode off the UI thread and hand the image back through the event loop
+      const QImage image(path);
+      QMetaObject::invokeMethod(this, [this, index, image]()
+      {
+        decoded(index, image);
+      }, Qt::QueuedConnection);
+    }));
+  }
+}
+
+void FramePrefetcher::decoded(int index, const QImage& image)
+{
+  m_inFlight.remove(index);
+
+  // the ImageFrame is created here, on the thread that owns this object
+  Frame frame;
+  if (!image.isNull())
+  {
+    frame.m_imageFrame = std::make_unique<ImageFrame>(image, m_extent);
+    frame.m_bytes = image.sizeInBytes();
+  }
+
+  ++m_decodedFrames;
+  m_cachedBytes += frame.m_bytes;
+  m_averageFrameBytes = m_cachedBytes / static_cast<qint64>(m_frames.size() + 1);
+  m_frames[index] = std::move(frame);
+
+  evict();
+  emit frameDecoded(index);
+  schedule();
+}
+
+int FramePrefetcher::priority(int index) const
+{
+  // frames ahead of the playhead are the most valuable, frames just behind it
+  // are kept for scrubbing backwards but count double their distance
+  const int count = frameCount();
+  const int ahead = (index - m_playhead + count) % count;
+  const int behind = (m_playhead - index + count) % count;
+  return std::min(ahead, 2 * behind);
+}
+
+void FramePrefetcher::evict()
+{
+  while (m_cachedBytes > m_memoryBudget && m_frames.size() > 1)
+  {
+    auto victim = m_frames.end();
+    for (auto it = m_frames.begin(); it != m_frames.end(); ++it)
+    {
+      if (it->first == m_playhead)
+        continue;
+
+      if (victim == m_frames.end() || priority(it->first) > priority(victim->first))
+        victim = it;
+    }
+
+    if (victim == m_frames.end())
+      return;
+
+    m_cachedBytes -= victim->second.m_bytes;
+    m_frames.erase(victim);
+  }
+}
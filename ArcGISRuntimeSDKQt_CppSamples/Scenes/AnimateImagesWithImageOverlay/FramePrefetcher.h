@@ -0,0 +1,95 @@
+// [WriteFile Name=AnimateImagesWithImageOverlay, Category=Scenes]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef FRAMEPREFETCHER_H
+#define FRAMEPREFETCHER_H
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+class ImageFrame;
+}
+}
+
+#include "Envelope.h"
+
+#include <QImage>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QThreadPool>
+
+#include <memory>
+#include <unordered_map>
+
+// Decodes image files on a thread pool ahead of a playhead and keeps the
+// resulting ImageFrames in a ring around it, so that frames can be shown
+// (and scrubbed backwards) without decoding on the UI thread.
+class FramePrefetcher : public QObject
+{
+  Q_OBJECT
+
+public:
+  FramePrefetcher(const QStringList& imagePaths, const Esri::ArcGISRuntime::Envelope& extent, QObject* parent = nullptr);
+  ~FramePrefetcher() override;
+
+  // number of frames decoded ahead of the playhead
+  void setLookahead(int frames);
+  int lookahead() const { return m_lookahead; }
+
+  // decoded frames are evicted once their size exceeds the budget, starting
+  // with the frames furthest from the playhead
+  void setMemoryBudget(qint64 bytes);
+  qint64 memoryBudget() const { return m_memoryBudget; }
+
+  int frameCount() const { return m_imagePaths.size(); }
+  qint64 cachedBytes() const { return m_cachedBytes; }
+  int decodedFrames() const { return m_decodedFrames; }
+
+  // moves the playhead and returns the frame at the index, or nullptr if it
+  // has not been decoded yet
+  Esri::ArcGISRuntime::ImageFrame* frameAt(int index);
+
+signals:
+  void frameDecoded(int index);
+
+private:
+  struct Frame
+  {
+    std::unique_ptr<Esri::ArcGISRuntime::ImageFrame> m_imageFrame;
+    qint64 m_bytes = 0;
+  };
+
+  void schedule();
+  void decoded(int index, const QImage& image);
+  void evict();
+  int priority(int index) const;
+
+  const QStringList m_imagePaths;
+  const Esri::ArcGISRuntime::Envelope m_extent;
+  std::unordered_map<int, Frame> m_frames;
+  QSet<int> m_inFlight;
+  QThreadPool m_threadPool;
+  int m_playhead = 0;
+  int m_lookahead = 16;
+  qint64 m_memoryBudget = 256 * 1024 * 1024;
+  qint64 m_cachedBytes = 0;
+  qint64 m_averageFrameBytes = 0;
+  int m_decodedFrames = 0;
+};
+
+#endif // FRAMEPREFETCHER_H
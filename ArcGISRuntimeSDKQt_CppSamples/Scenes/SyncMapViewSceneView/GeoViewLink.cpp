@@ -0,0 +1,132 @@
+// [WriteFile Name=SyncMapViewSceneView, Category=Scenes]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "GeoViewLink.h"
+
+#include <QQuickWindow>
+
+using namespace Esri::ArcGISRuntime;
+
+GeoViewLink::GeoViewLink(QObject* parent /* = nullptr */):
+  QObject(parent)
+{
+  m_clock.start();
+}
+
+GeoViewLink::~GeoViewLink() = default;
+
+QVariantMap GeoViewLink::syncLags() const
+{
+  QVariantMap lags;
+  for (const LinkedView& view : m_views)
+  {
+    if (view.syncLag >= 0)
+      lags.insert(view.name, view.syncLag);
+  }
+
+  return lags;
+}
+
+void GeoViewLink::handleViewpointChanged(int index)
+{
+  LinkedView& view = m_views[index];
+
+  // a follower reporting the viewpoint it was given
+  if (index != m_leader && view.awaitingViewpoint)
+  {
+    view.awaitingViewpoint = false;
+    view.syncLag = m_clock.elapsed() - view.pushedChangeTime;
+    emit syncLagsChanged();
+    return;
+  }
+
+  // the view the user navigates leads until it stops; changes from followers are not echoed back
+  if (m_leader == -1 && view.isNavigating())
+    m_leader = index;
+
+  if (index != m_leader)
+    return;
+
+  scheduleSync();
+}
+
+void GeoViewLink::handleNavigatingChanged(int index)
+{
+  if (index != m_leader || m_views.at(index).isNavigating())
+    return;
+
+  // push the final viewpoint before another view may lead
+  sync();
+  m_leader = -1;
+}
+
+// Requests a sync with the next frame of the leader's window.
+void GeoViewLink::scheduleSync()
+{
+  if (!m_syncPending)
+  {
+    m_syncPending = true;
+    m_firstPendingChangeTime = m_clock.elapsed();
+  }
+
+  QQuickItem* item = m_views.at(m_leader).item;
+  QQuickWindow* window = item ? item->window() : nullptr;
+  if (!window)
+  {
+    sync();
+    return;
+  }
+
+  if (!m_windows.contains(window))
+  {
+    m_windows.insert(window);
+    connect(window, &QQuickWindow::afterAnimating, this, &GeoViewLink::sync);
+    connect(window, &QObject::destroyed, this, [this, window]()
+    {
+      m_windows.remove(window);
+    });
+  }
+
+  window->update();
+}
+
+// Pushes the leader's viewpoint to all followers if it changed since the last sync.
+void GeoViewLink::sync()
+{
+  if (!m_syncPending || m_leader == -1 || !m_views.at(m_leader).item)
+    return;
+
+  m_syncPending = false;
+
+  const Viewpoint viewpoint = m_views.at(m_leader).currentViewpoint();
+  for (int i = 0; i < m_views.size(); ++i)
+  {
+    LinkedView& view = m_views[i];
+    if (i == m_leader || !view.item)
+      continue;
+
+    // a lag is measured from the first change that this push includes
+    if (!view.awaitingViewpoint)
+      view.pushedChangeTime = m_firstPendingChangeTime;
+
+    view.awaitingViewpoint = true;
+    view.setViewpoint(viewpoint);
+  }
+}
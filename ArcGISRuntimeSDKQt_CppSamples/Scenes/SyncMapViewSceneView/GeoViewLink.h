@@ -0,0 +1,118 @@
+// [WriteFile Name=SyncMapViewSceneView, Category=Scenes]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef GEOVIEWLINK_H
+#define GEOVIEWLINK_H
+
+#include "Viewpoint.h"
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QSet>
+#include <QVariantMap>
+
+#include <functional>
+
+class QQuickWindow;
+
+// Keeps the viewpoints of any number of map and scene views in step.
+// The view the user is navigating becomes the leader; viewpoint changes
+// from the other views are ignored until it stops, which prevents the
+// views from feeding their updates back to each other. Leader changes are
+// coalesced and pushed to the followers at most once per rendered frame.
+class GeoViewLink : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit GeoViewLink(QObject* parent = nullptr);
+  ~GeoViewLink() override;
+
+  // ViewType is MapQuickView or SceneQuickView
+  template <typename ViewType>
+  void addView(ViewType* view, const QString& name);
+
+  // the latest time in milliseconds from a leader change until each follower applied it, by view name
+  QVariantMap syncLags() const;
+
+signals:
+  void syncLagsChanged();
+
+private:
+  struct LinkedView
+  {
+    QString name;
+    QPointer<QQuickItem> item;
+    std::function<Esri::ArcGISRuntime::Viewpoint()> currentViewpoint;
+    std::function<void(const Esri::ArcGISRuntime::Viewpoint&)> setViewpoint;
+    std::function<bool()> isNavigating;
+    // set while a pushed viewpoint has not been reported back by the view
+    bool awaitingViewpoint = false;
+    qint64 pushedChangeTime = 0;
+    qint64 syncLag = -1;
+  };
+
+  void handleViewpointChanged(int index);
+  void handleNavigatingChanged(int index);
+  void scheduleSync();
+  void sync();
+
+  QList<LinkedView> m_views;
+  int m_leader = -1;
+  bool m_syncPending = false;
+  // time of the first leader change that has not been pushed yet
+  qint64 m_firstPendingChangeTime = 0;
+  QElapsedTimer m_clock;
+  QSet<QQuickWindow*> m_windows;
+};
+
+template <typename ViewType>
+void GeoViewLink::addView(ViewType* view, const QString& name)
+{
+  LinkedView linkedView;
+  linkedView.name = name;
+  linkedView.item = view;
+  linkedView.currentViewpoint = [view]()
+  {
+    return view->currentViewpoint(Esri::ArcGISRuntime::ViewpointType::CenterAndScale);
+  };
+  linkedView.setViewpoint = [view](const Esri::ArcGISRuntime::Viewpoint& viewpoint)
+  {
+    view->setViewpoint(viewpoint, 0);
+  };
+  linkedView.isNavigating = [view]()
+  {
+    return view->isNavigating();
+  };
+
+  const int index = m_views.size();
+  m_views.append(linkedView);
+
+  connect(view, &ViewType::viewpointChanged, this, [this, index]()
+  {
+    handleViewpointChanged(index);
+  });
+
+  connect(view, &ViewType::navigatingChanged, this, [this, index]()
+  {
+    handleNavigatingChanged(index);
+  });
+}
+
+#endif // GEOVIEWLINK_H
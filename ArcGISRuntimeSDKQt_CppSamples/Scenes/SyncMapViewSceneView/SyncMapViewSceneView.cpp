@@ -20,6 +20,8 @@
 
 #include "SyncMapViewSceneView.h"
 
+#include "GeoViewLink.h"
+
 #include "ArcGISTiledElevationSource.h"
 #include "Scene.h"
 #include "SceneQuickView.h"
@@ -31,8 +33,10 @@ using namespace Esri::ArcGISRuntime;
 SyncMapViewSceneView::SyncMapViewSceneView(QObject* parent /* = nullptr */):
   QObject(parent),
   m_scene(new Scene(BasemapStyle::ArcGISImageryStandard, this)),
-  m_map(new Map(BasemapStyle::ArcGISImageryStandard, this))
+  m_map(new Map(BasemapStyle::ArcGISImageryStandard, this)),
+  m_viewLink(new GeoViewLink(this))
 {
+  connect(m_viewLink, &GeoViewLink::syncLagsChanged, this, &SyncMapViewSceneView::syncLagChanged);
 }
 
 SyncMapViewSceneView::~SyncMapViewSceneView() = default;
@@ -61,14 +65,8 @@ void SyncMapViewSceneView::setSceneView(SceneQuickView* sceneView)
   m_sceneView = sceneView;
   m_sceneView->setArcGISScene(m_scene);
 
-  connect(m_sceneView, &SceneQuickView::viewpointChanged, this,
-          [this]
-  {
-    if (m_mapView && m_sceneView->isNavigating())
-      m_mapView->setViewpoint(m_sceneView->currentViewpoint(ViewpointType::CenterAndScale), 0);
-
-  },
-  Qt::UniqueConnection);
+  // keep the viewpoint of the scene view in step with the other linked views
+  m_viewLink->addView(m_sceneView, "Scene");
 
   emit sceneViewChanged();
 }
@@ -90,14 +88,18 @@ void SyncMapViewSceneView::setMapView(MapQuickView* mapView)
   m_mapView->setMap(m_map);
   m_mapView->setRotationByPinchingEnabled(true);
 
-  connect(m_mapView, &MapQuickView::viewpointChanged, this,
-          [this]
-  {
-    if (m_sceneView && m_mapView->isNavigating())
-      m_sceneView->setViewpoint(m_mapView->currentViewpoint(ViewpointType::CenterAndScale), 0);
-
-  },
-  Qt::UniqueConnection);
+  // keep the viewpoint of the map view in step with the other linked views
+  m_viewLink->addView(m_mapView, "Map");
 
   emit mapViewChanged();
 }
+
+QString SyncMapViewSceneView::syncLag() const
+{
+  QStringList lags;
+  const QVariantMap syncLags = m_viewLink->syncLags();
+  for (auto it = syncLags.cbegin(); it != syncLags.cend(); ++it)
+    lags << QString("%1: %2 ms").arg(it.key()).arg(it.value().toLongLong());
+
+  return lags.join(", ");
+}
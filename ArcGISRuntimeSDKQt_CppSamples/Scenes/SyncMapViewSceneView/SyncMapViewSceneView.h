@@ -31,12 +31,15 @@ class MapQuickView;
 
 #include <QObject>
 
+class GeoViewLink;
+
 class SyncMapViewSceneView : public QObject
 {
   Q_OBJECT
 
   Q_PROPERTY(Esri::ArcGISRuntime::SceneQuickView* sceneView READ sceneView WRITE setSceneView NOTIFY sceneViewChanged)
   Q_PROPERTY(Esri::ArcGISRuntime::MapQuickView* mapView READ mapView WRITE setMapView NOTIFY mapViewChanged)
+  Q_PROPERTY(QString syncLag READ syncLag NOTIFY syncLagChanged)
 
 public:
   explicit SyncMapViewSceneView(QObject* parent = nullptr);
@@ -47,6 +50,7 @@ public:
 signals:
   void sceneViewChanged();
   void mapViewChanged();
+  void syncLagChanged();
 
 private:
   Esri::ArcGISRuntime::SceneQuickView* sceneView() const;
@@ -55,11 +59,15 @@ private:
   Esri::ArcGISRuntime::MapQuickView* mapView() const;
   void setMapView(Esri::ArcGISRuntime::MapQuickView* mapView);
 
+  QString syncLag() const;
+
   Esri::ArcGISRuntime::Scene* m_scene = nullptr;
   Esri::ArcGISRuntime::SceneQuickView* m_sceneView = nullptr;
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
+
+  GeoViewLink* m_viewLink = nullptr;
 };
 
 #endif // SYNCMAPVIEWSCENEVIEW_H
@@ -33,10 +33,12 @@ include($$PWD/arcgisruntime.pri)
 #-------------------------------------------------------------------------------
 
 HEADERS += \
+    GeoViewLink.h \
     SyncMapViewSceneView.h
 
 SOURCES += \
     main.cpp \
+    GeoViewLink.cpp \
     SyncMapViewSceneView.cpp
 
 RESOURCES += SyncMapViewSceneView.qrc
@@ -54,6 +54,26 @@ Item {
         }
     }
 
+    Rectangle {
+        anchors {
+            left: parent.left
+            top: parent.top
+            margins: 5
+        }
+        width: lagText.width + 10
+        height: lagText.height + 10
+        color: "white"
+        opacity: 0.85
+        radius: 5
+        visible: model.syncLag.length > 0
+
+        Text {
+            id: lagText
+            anchors.centerIn: parent
+            text: "Sync lag - " + model.syncLag
+        }
+    }
+
     // Declare the C++ instance which creates the scene etc. and supply the view
     SyncMapViewSceneViewSample {
         id: model
@@ -37,6 +37,7 @@
 #include <QScopedPointer>
 #include <QDir>
 #include <QtCore/qglobal.h>
+#include <cmath>
 #include <memory>
 
 #ifdef Q_OS_IOS
@@ -62,13 +63,19 @@ namespace
 
     return dataPath;
   }
+
+  // size of a reverse geocode cache cell in map units (meters in web mercator)
+  // and the maximum number of cells kept in the cache
+  constexpr double reverseGeocodeCellSize = 10.0;
+  constexpr int reverseGeocodeCacheSize = 2000;
 } // namespace
 
 using namespace Esri::ArcGISRuntime;
 
 OfflineGeocode::OfflineGeocode(QQuickItem* parent):
   QQuickItem(parent),
-  m_dataPath(defaultDataPath() + "/ArcGIS/Runtime/Data/")
+  m_dataPath(defaultDataPath() + "/ArcGIS/Runtime/Data/"),
+  m_reverseGeocodeCache(reverseGeocodeCacheSize)
 {
 }
 
@@ -196,23 +203,14 @@ void OfflineGeocode::connectSignals()
     m_isReverseGeocode = true;
 
     // reverse geocode
-    m_locatorTask->reverseGeocodeWithParameters(Point(m_mapView->screenToLocation(mouseEvent.x(), mouseEvent.y())), m_reverseGeocodeParameters);
-
-    // make busy indicator visible
-    m_geocodeInProgress = true;
-    emit geocodeInProgressChanged();
+    reverseGeocode(m_mapView->screenToLocation(mouseEvent.x(), mouseEvent.y()));
   });
 
   connect(m_mapView, &MapQuickView::mouseMoved, this, [this](QMouseEvent& mouseEvent)
   {
     // if user is dragging mouse hold, realtime reverse geocode
     if (m_isPressAndHold)
-    {
-      m_locatorTask->reverseGeocodeWithParameters(Point(m_mapView->screenToLocation(mouseEvent.x(), mouseEvent.y())), m_reverseGeocodeParameters);
-
-      m_geocodeInProgress = true;
-      emit geocodeInProgressChanged();
-    }
+      reverseGeocode(m_mapView->screenToLocation(mouseEvent.x(), mouseEvent.y()));
   });
 
   // reset after user stops holding down mouse
@@ -254,58 +252,161 @@ void OfflineGeocode::connectSignals()
     // otherwise, reverse geocode at that point
     else
     {
-      m_isReverseGeocode = true;
-      m_locatorTask->reverseGeocodeWithParameters(m_clickedPoint, m_reverseGeocodeParameters);
-
-      m_geocodeInProgress = true;
-      emit geocodeInProgressChanged();
+      reverseGeocode(m_clickedPoint);
     }
   });
 
   connect(m_locatorTask, &LocatorTask::errorOccurred, this, &OfflineGeocode::logError);
-  connect(m_locatorTask, &LocatorTask::geocodeCompleted, this, [this](QUuid, const QList<GeocodeResult>& geocodeResults)
+  // the error does not name its task. It releases the reverse geocode slot
+  // whenever one is in flight and has not been cancelled, so a failed reverse
+  // geocode never blocks the pending one.
+  connect(m_locatorTask, &LocatorTask::errorOccurred, this, [this]()
   {
-    // dismiss busy indicator
+    if (m_reverseGeocodeTaskId.isNull() || m_reverseGeocodeWatcher.isCanceled())
+      return;
+
     m_geocodeInProgress = false;
     emit geocodeInProgressChanged();
+    reverseGeocodeCompleted();
+  });
 
-    if (geocodeResults.length() > 0)
+  connect(m_locatorTask, &LocatorTask::geocodeCompleted, this, [this](QUuid taskId, const QList<GeocodeResult>& geocodeResults)
+  {
+    if (taskId.isNull() || taskId != m_reverseGeocodeTaskId)
     {
-      // dismiss no results notification
-      m_noResults = false;
-      emit noResultsChanged();
-
-      // dismiss callouts
-      m_calloutData->setVisible(false);
-
-      // zoom to result's extent
-      m_mapView->setViewpointCenter(geocodeResults.at(0).displayLocation());
-
-      // set pin graphic's location
-      m_pinGraphic->setGeometry(geocodeResults.at(0).displayLocation());
-      m_pinGraphic->setVisible(true);
-
-      // set callout location and detail
-      m_calloutData->setDetail(geocodeResults.at(0).label());
-      m_calloutData->setGeoElement(m_pinGraphic);
+      displayGeocodeResults(geocodeResults);
+      return;
+    }
 
-      if (m_isReverseGeocode)
-        m_calloutData->setVisible(true);
+    m_reverseGeocodeCache.insert(m_reverseGeocodeCellKey, new QList<GeocodeResult>(geocodeResults));
 
-      // continue reverse geocoding if user is pressing and holding
-      if (!m_isPressAndHold)
-        m_isReverseGeocode = false;
+    // a newer location was already answered from the cache, so this result is stale
+    if (!m_reverseGeocodeSuperseded)
+    {
+      displayGeocodeResults(geocodeResults);
     }
-
-    // if there are no matching results, notify user
     else
     {
-      m_noResults = true;
-      emit noResultsChanged();
+      m_geocodeInProgress = false;
+      emit geocodeInProgressChanged();
     }
+
+    reverseGeocodeCompleted();
   });
 }
 
+void OfflineGeocode::reverseGeocode(const Point& location)
+{
+  m_isReverseGeocode = true;
+
+  // answer from the cache if a location in the same cell was reverse geocoded before
+  const quint64 key = cacheKey(location);
+  if (const QList<GeocodeResult>* cachedResults = m_reverseGeocodeCache.object(key))
+  {
+    ++m_cacheHits;
+    emit reverseGeocodeStatisticsChanged();
+
+    m_hasPendingReverseGeocode = false;
+    m_reverseGeocodeSuperseded = !m_reverseGeocodeTaskId.isNull();
+    displayGeocodeResults(*cachedResults);
+    return;
+  }
+
+  // keep at most one request in flight. While dragging, newer locations replace
+  // the pending one and only the latest is sent once the locator is free.
+  if (!m_reverseGeocodeTaskId.isNull())
+  {
+    m_pendingReverseGeocodeLocation = location;
+    m_hasPendingReverseGeocode = true;
+    return;
+  }
+
+  ++m_cacheMisses;
+  m_reverseGeocodeCellKey = key;
+  m_reverseGeocodeSuperseded = false;
+  m_reverseGeocodeClock.start();
+  m_reverseGeocodeWatcher = m_locatorTask->reverseGeocodeWithParameters(location, m_reverseGeocodeParameters);
+  m_reverseGeocodeTaskId = m_reverseGeocodeWatcher.taskId();
+
+  // make busy indicator visible
+  m_geocodeInProgress = true;
+  emit geocodeInProgressChanged();
+}
+
+void OfflineGeocode::reverseGeocodeCompleted()
+{
+  ++m_reverseGeocodeCount;
+  m_totalReverseGeocodeLatency += m_reverseGeocodeClock.elapsed();
+  m_reverseGeocodeTaskId = QUuid();
+  emit reverseGeocodeStatisticsChanged();
+
+  if (m_hasPendingReverseGeocode)
+  {
+    m_hasPendingReverseGeocode = false;
+    reverseGeocode(m_pendingReverseGeocodeLocation);
+  }
+}
+
+quint64 OfflineGeocode::cacheKey(const Point& location) const
+{
+  const auto column = static_cast<qint32>(std::floor(location.x() / reverseGeocodeCellSize));
+  const auto row = static_cast<qint32>(std::floor(location.y() / reverseGeocodeCellSize));
+  return (static_cast<quint64>(static_cast<quint32>(column)) << 32) | static_cast<quint32>(row);
+}
+
+double OfflineGeocode::cacheHitRate() const
+{
+  const int lookups = m_cacheHits + m_cacheMisses;
+  return lookups > 0 ? static_cast<double>(m_cacheHits) / lookups : 0.0;
+}
+
+double OfflineGeocode::averageReverseGeocodeLatency() const
+{
+  return m_reverseGeocodeCount > 0 ? static_cast<double>(m_totalReverseGeocodeLatency) / m_reverseGeocodeCount : 0.0;
+}
+
+void OfflineGeocode::displayGeocodeResults(const QList<GeocodeResult>& geocodeResults)
+{
+  // dismiss busy indicator
+  m_geocodeInProgress = false;
+  emit geocodeInProgressChanged();
+
+  if (geocodeResults.length() > 0)
+  {
+    // dismiss no results notification
+    m_noResults = false;
+    emit noResultsChanged();
+
+    // dismiss callouts
+    m_calloutData->setVisible(false);
+
+    // zoom to result's extent
+    m_mapView->setViewpointCenter(geocodeResults.at(0).displayLocation());
+
+    // set pin graphic's location
+    m_pinGraphic->setGeometry(geocodeResults.at(0).displayLocation());
+    m_pinGraphic->setVisible(true);
+
+    // set callout location and detail
+    m_calloutData->setDetail(geocodeResults.at(0).label());
+    m_calloutData->setGeoElement(m_pinGraphic);
+
+    if (m_isReverseGeocode)
+      m_calloutData->setVisible(true);
+
+    // continue reverse geocoding if user is pressing and holding
+    if (!m_isPressAndHold)
+      m_isReverseGeocode = false;
+  }
+
+  // if there are no matching results, notify user
+  else
+  {
+    m_noResults = true;
+    emit noResultsChanged();
+  }
+}
+
 QString OfflineGeocode::errorMessage() const
 {
   return m_errorMsg;
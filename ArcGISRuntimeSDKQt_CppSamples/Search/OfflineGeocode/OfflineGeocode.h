@@ -34,11 +34,16 @@ namespace Esri
 
 #include "Point.h"
 #include "Error.h"
+#include "GeocodeResult.h"
 #include "SuggestResult.h"
 #include "GeocodeParameters.h"
 #include "ReverseGeocodeParameters.h"
+#include "TaskWatcher.h"
 
+#include <QCache>
+#include <QElapsedTimer>
 #include <QQuickItem>
+#include <QUuid>
 
 class OfflineGeocode : public QQuickItem
 {
@@ -49,6 +54,8 @@ class OfflineGeocode : public QQuickItem
   Q_PROPERTY(bool suggestInProgress READ suggestInProgress NOTIFY suggestInProgressChanged)
   Q_PROPERTY(bool noResults READ noResults NOTIFY noResultsChanged)
   Q_PROPERTY(QString errorMessage READ errorMessage NOTIFY errorMessageChanged)
+  Q_PROPERTY(double cacheHitRate READ cacheHitRate NOTIFY reverseGeocodeStatisticsChanged)
+  Q_PROPERTY(double averageReverseGeocodeLatency READ averageReverseGeocodeLatency NOTIFY reverseGeocodeStatisticsChanged)
 
 public:
   explicit OfflineGeocode(QQuickItem* parent = nullptr);
@@ -67,6 +74,7 @@ signals:
   void geocodeInProgressChanged();
   void dismissSuggestions();
   void errorMessageChanged();
+  void reverseGeocodeStatisticsChanged();
 
 private slots:
   void logError(const Esri::ArcGISRuntime::Error error);
@@ -79,6 +87,12 @@ private:
   void connectSignals();
   QString errorMessage() const;
   void setErrorMessage(const QString& msg);
+  void reverseGeocode(const Esri::ArcGISRuntime::Point& location);
+  void reverseGeocodeCompleted();
+  void displayGeocodeResults(const QList<Esri::ArcGISRuntime::GeocodeResult>& geocodeResults);
+  quint64 cacheKey(const Esri::ArcGISRuntime::Point& location) const;
+  double cacheHitRate() const;
+  double averageReverseGeocodeLatency() const;
 
   bool m_isReverseGeocode = false;
   bool m_geocodeInProgress = false;
@@ -98,6 +112,20 @@ private:
   Esri::ArcGISRuntime::SuggestListModel* m_suggestListModel = nullptr;
   Esri::ArcGISRuntime::GeocodeParameters m_geocodeParameters;
   Esri::ArcGISRuntime::ReverseGeocodeParameters m_reverseGeocodeParameters;
+
+  // reverse geocode results keyed by the grid cell of the requested location
+  QCache<quint64, QList<Esri::ArcGISRuntime::GeocodeResult>> m_reverseGeocodeCache;
+  QUuid m_reverseGeocodeTaskId;
+  Esri::ArcGISRuntime::TaskWatcher m_reverseGeocodeWatcher;
+  quint64 m_reverseGeocodeCellKey = 0;
+  Esri::ArcGISRuntime::Point m_pendingReverseGeocodeLocation;
+  bool m_hasPendingReverseGeocode = false;
+  bool m_reverseGeocodeSuperseded = false;
+  QElapsedTimer m_reverseGeocodeClock;
+  int m_cacheHits = 0;
+  int m_cacheMisses = 0;
+  int m_reverseGeocodeCount = 0;
+  qint64 m_totalReverseGeocodeLatency = 0;
 };
 
 #endif // OFFLINEGEOCODE_H
@@ -175,6 +175,16 @@ OfflineGeocodeSample {
         visible: offlineGeocodeSample.geocodeInProgress
     }
 
+    Text {
+        anchors {
+            left: parent.left
+            bottom: mapView.attributionTop
+            margins: 5
+        }
+        text: "Reverse geocode cache hit rate: " + (offlineGeocodeSample.cacheHitRate * 100).toFixed(0) +
+              "%, average latency: " + offlineGeocodeSample.averageReverseGeocodeLatency.toFixed(0) + " ms"
+    }
+
     Rectangle {
         id: noResultsRect
         anchors.centerIn: parent
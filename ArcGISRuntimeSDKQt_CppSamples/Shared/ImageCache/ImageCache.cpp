@@ -0,0 +1,392 @@
+// [WriteFile Name=ImageCache, Category=Shared]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifdef PCH_BUILD
+#include "pch.hpp"
+#endif // PCH_BUILD
+
+#include "ImageCache.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QMutexLocker>
+#include <QTemporaryDir>
+
+ImageCache::ImageCache(qint64 byteBudget, QObject* parent) :
+  QObject(parent),
+  m_byteBudget(byteBudget)
+{
+}
+
+// the temporary directory removes the spilled images with it
+ImageCache::~ImageCache() = default;
+
+void ImageCache::setByteBudget(qint64 byteBudget)
+{
+  {
+    QMutexLocker locker(&m_mutex);
+    m_byteBudget = byteBudget;
+    evict();
+  }
+
+  writeSpills();
+  notifyStatisticsChanged();
+}
+
+qint64 ImageCache::byteBudget() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_byteBudget;
+}
+
+bool ImageCache::enableSpilling(const QString& prefix)
+{
+  auto directory = std::make_unique<QTemporaryDir>(QDir::temp().filePath(prefix + "-XXXXXX"));
+  if (!directory->isValid())
+    return false;
+
+  QMutexLocker locker(&m_mutex);
+  if (!m_spillDirectory)
+    m_spillDirectory = std::move(directory);
+
+  m_spillingEnabled = true;
+  return true;
+}
+
+bool ImageCache::isSpillingEnabled() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_spillingEnabled;
+}
+
+void ImageCache::insert(const QString& id, const QImage& image)
+{
+  {
+    QMutexLocker locker(&m_mutex);
+
+    // a new image for an existing id invalidates everything derived from the old one
+    removeVariants(id);
+    discardSpill(id);
+
+    m_originalSizes.insert(id, image.size());
+    store(id, image, QString());
+    evict();
+  }
+
+  writeSpills();
+  notifyStatisticsChanged();
+}
+
+QImage ImageCache::image(const QString& id, QSize* size, const QSize& requestedSize)
+{
+  const QImage result = lookup(id, size, requestedSize);
+  writeSpills();
+  notifyStatisticsChanged();
+  return result;
+}
+
+ImageCache::Statistics ImageCache::statistics() const
+{
+  QMutexLocker locker(&m_mutex);
+  m_notificationPending = false;
+  return m_statistics;
+}
+
+QString ImageCache::Statistics::toString() const
+{
+  return QString("%1 hits, %2 misses, %3 evictions, %4 spills, %5 reloads, %6 KB held")
+      .arg(hits).arg(misses).arg(evictions).arg(spills).arg(reloads).arg(bytes / 1024);
+}
+
+QString ImageCache::variantKey(const QString& id, const QSize& size)
+{
+  return QString("%1@%2x%3").arg(id).arg(size.width()).arg(size.height());
+}
+
+QSize ImageCache::scaledSize(const QSize& originalSize, const QSize& requestedSize)
+{
+  if (requestedSize.width() <= 0 && requestedSize.height() <= 0)
+    return originalSize;
+
+  // a missing dimension follows the aspect ratio of the original
+  QSize boundingSize = requestedSize;
+  if (boundingSize.width() <= 0)
+    boundingSize.setWidth(originalSize.width());
+  if (boundingSize.height() <= 0)
+    boundingSize.setHeight(originalSize.height());
+
+  // images are only scaled down
+  const QSize targetSize = originalSize.scaled(boundingSize, Qt::KeepAspectRatio);
+  if (targetSize.isEmpty() || targetSize.width() >= originalSize.width())
+    return originalSize;
+
+  return targetSize;
+}
+
+QImage ImageCache::lookup(const QString& id, QSize* size, const QSize& requestedSize)
+{
+  QMutexLocker locker(&m_mutex);
+
+  const auto originalSize = m_originalSizes.constFind(id);
+  if (originalSize == m_originalSizes.constEnd())
+  {
+    ++m_statistics.misses;
+    return QImage();
+  }
+
+  if (size)
+    *size = originalSize.value();
+
+  // a cached variant is served without its original, which may have been spilled
+  const QSize targetSize = scaledSize(originalSize.value(), requestedSize);
+  const QString key = variantKey(id, targetSize);
+  if (targetSize != originalSize.value())
+  {
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+      ++m_statistics.hits;
+      m_lru.splice(m_lru.begin(), m_lru, it->lruPosition);
+      return it->image;
+    }
+  }
+
+  QImage originalImage = cachedOriginal(id);
+  if (originalImage.isNull())
+  {
+    ++m_statistics.misses;
+
+    const QString path = m_spilled.value(id);
+    if (path.isEmpty())
+    {
+      m_originalSizes.remove(id);
+      return QImage();
+    }
+
+    // decode the spilled file without holding the lock
+    locker.unlock();
+    const QImage reloaded(path);
+    locker.relock();
+
+    // another request reloaded or replaced the image in the meantime
+    if (m_spilled.value(id) != path)
+    {
+      locker.unlock();
+      return lookup(id, size, requestedSize);
+    }
+
+    m_spilled.remove(id);
+    m_obsoleteFiles.append(path);
+    if (reloaded.isNull())
+    {
+      m_originalSizes.remove(id);
+      return reloaded;
+    }
+
+    ++m_statistics.reloads;
+    store(id, reloaded, QString());
+    originalImage = reloaded;
+  }
+
+  // scale the original only the first time a variant is requested
+  QImage result = originalImage;
+  if (targetSize != originalImage.size())
+  {
+    result = originalImage.scaled(targetSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    store(key, result, id);
+  }
+
+  evict();
+  return result;
+}
+
+QImage ImageCache::cachedOriginal(const QString& id)
+{
+  auto it = m_entries.find(id);
+  if (it != m_entries.end())
+  {
+    ++m_statistics.hits;
+    m_lru.splice(m_lru.begin(), m_lru, it->lruPosition);
+    return it->image;
+  }
+
+  // an original that is being written to disk is still in memory; taking it
+  // back makes the writer discard its file
+  auto pending = m_pendingSpills.find(id);
+  if (pending == m_pendingSpills.end())
+    return QImage();
+
+  ++m_statistics.hits;
+  const QImage image = pending->image;
+  m_pendingSpills.erase(pending);
+  store(id, image, QString());
+  return image;
+}
+
+void ImageCache::store(const QString& key, const QImage& image, const QString& originalId)
+{
+  remove(key);
+
+  m_lru.push_front(key);
+
+  Entry entry;
+  entry.image = image;
+  entry.lruPosition = m_lru.begin();
+  entry.originalId = originalId;
+  m_entries.insert(key, entry);
+
+  if (!originalId.isEmpty())
+    m_variants[originalId].append(key);
+
+  m_statistics.bytes += image.sizeInBytes();
+}
+
+void ImageCache::remove(const QString& key)
+{
+  auto it = m_entries.find(key);
+  if (it == m_entries.end())
+    return;
+
+  if (!it->originalId.isEmpty())
+  {
+    auto variants = m_variants.find(it->originalId);
+    if (variants != m_variants.end())
+    {
+      variants->removeOne(key);
+      if (variants->isEmpty())
+        m_variants.erase(variants);
+    }
+  }
+
+  m_statistics.bytes -= it->image.sizeInBytes();
+  m_lru.erase(it->lruPosition);
+  m_entries.erase(it);
+}
+
+void ImageCache::removeVariants(const QString& id)
+{
+  const QStringList variants = m_variants.take(id);
+  for (const QString& key : variants)
+    remove(key);
+}
+
+void ImageCache::discardSpill(const QString& id)
+{
+  m_pendingSpills.remove(id);
+  if (m_spilled.contains(id))
+    m_obsoleteFiles.append(m_spilled.take(id));
+}
+
+void ImageCache::evict()
+{
+  // walk from the least recently used entry towards the most recent one
+  auto candidate = m_lru.end();
+  while (m_statistics.bytes > m_byteBudget && candidate != m_lru.begin())
+  {
+    --candidate;
+    const QString key = *candidate;
+    const Entry& entry = m_entries[key];
+
+    // variants can be scaled again from their original, but an original
+    // cannot be recreated and is only evicted when it can be spilled to disk.
+    // The file is written by writeSpills() once the lock is released.
+    if (entry.originalId.isEmpty())
+    {
+      if (!m_spillingEnabled)
+        continue;
+
+      PendingSpill spill;
+      spill.image = entry.image;
+      spill.generation = ++m_spillGeneration;
+      spill.path = spillPath(key, spill.generation);
+      m_pendingSpills.insert(key, spill);
+      m_spillQueue.append(SpillJob{key, spill});
+    }
+
+    // step back onto the entry after the removed one, which stays valid
+    ++candidate;
+    remove(key);
+    ++m_statistics.evictions;
+  }
+}
+
+void ImageCache::writeSpills()
+{
+  QList<SpillJob> jobs;
+  QStringList obsoleteFiles;
+  {
+    QMutexLocker locker(&m_mutex);
+    jobs.swap(m_spillQueue);
+    obsoleteFiles.swap(m_obsoleteFiles);
+  }
+
+  for (const QString& path : qAsConst(obsoleteFiles))
+    QFile::remove(path);
+
+  for (const SpillJob& job : qAsConst(jobs))
+  {
+    const bool saved = job.spill.image.save(job.spill.path, "PNG");
+    if (!saved)
+      QFile::remove(job.spill.path);
+
+    QMutexLocker locker(&m_mutex);
+    auto pending = m_pendingSpills.find(job.id);
+    if (pending == m_pendingSpills.end() || pending->generation != job.spill.generation)
+    {
+      // the image was requested again or replaced while it was written
+      locker.unlock();
+      if (saved)
+        QFile::remove(job.spill.path);
+
+      continue;
+    }
+
+    m_pendingSpills.erase(pending);
+    if (saved)
+    {
+      m_spilled.insert(job.id, job.spill.path);
+      ++m_statistics.spills;
+      continue;
+    }
+
+    // keep the original in memory rather than losing it, and stop spilling
+    // to a directory that cannot be written
+    m_spillingEnabled = false;
+    store(job.id, job.spill.image, QString());
+  }
+}
+
+void ImageCache::notifyStatisticsChanged()
+{
+  {
+    QMutexLocker locker(&m_mutex);
+    if (m_notificationPending)
+      return;
+
+    m_notificationPending = true;
+  }
+
+  emit statisticsChanged();
+}
+
+QString ImageCache::spillPath(const QString& id, quint64 generation) const
+{
+  // each spill gets its own file, so removing an obsolete file never races
+  // with a newer spill of the same image
+  const QByteArray hash = QCryptographicHash::hash(id.toUtf8(), QCryptographicHash::Sha1).toHex();
+  return QDir(m_spillDirectory->path()).filePath(QString("%1-%2.png").arg(QString::fromLatin1(hash)).arg(generation));
+}
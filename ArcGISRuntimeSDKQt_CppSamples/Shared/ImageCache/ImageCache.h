@@ -0,0 +1,140 @@
+// [WriteFile Name=ImageCache, Category=Shared]
+// [Legal]
+// Copyright 2021 Esri.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// [Legal]
+
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+// Qt headers
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+
+// STL headers
+#include <list>
+#include <memory>
+
+class QTemporaryDir;
+
+// Thread safe LRU store of images bounded by a byte budget. Scaled variants
+// requested by size are cached alongside the originals and share the budget.
+// Originals cannot be recreated by the cache, so an original is only evicted
+// when spilling is enabled: it is then written to disk as a PNG file and
+// reloaded from there on the next request. Encoding, writing and reading the
+// files happens without holding the cache's lock.
+class ImageCache : public QObject
+{
+  Q_OBJECT
+
+public:
+  struct Statistics
+  {
+    qint64 hits = 0;
+    qint64 misses = 0;
+    qint64 evictions = 0;
+    qint64 spills = 0;
+    qint64 reloads = 0;
+    qint64 bytes = 0;
+
+    QString toString() const;
+  };
+
+  explicit ImageCache(qint64 byteBudget = defaultByteBudget, QObject* parent = nullptr);
+  ~ImageCache() override;
+
+  void setByteBudget(qint64 byteBudget);
+  qint64 byteBudget() const;
+
+  // spills evicted originals to a new temporary directory, named after
+  // prefix, which is removed with the cache. Returns false if the directory
+  // could not be created, in which case originals are kept in memory.
+  bool enableSpilling(const QString& prefix);
+  bool isSpillingEnabled() const;
+
+  void insert(const QString& id, const QImage& image);
+
+  // returns the image scaled to the requested size (keeping its aspect ratio)
+  // and sets size to the size of the original image
+  QImage image(const QString& id, QSize* size, const QSize& requestedSize);
+
+  Statistics statistics() const;
+
+  static constexpr qint64 defaultByteBudget = 64 * 1024 * 1024;
+
+signals:
+  // emitted from the thread that used the cache; it is not emitted again
+  // until the statistics have been read
+  void statisticsChanged();
+
+private:
+  struct Entry
+  {
+    QImage image;
+    std::list<QString>::iterator lruPosition;
+    // the id of the original image for scaled variants, empty for originals
+    QString originalId;
+  };
+
+  // an evicted original that is still in memory while it is written to disk
+  struct PendingSpill
+  {
+    QImage image;
+    QString path;
+    quint64 generation = 0;
+  };
+
+  struct SpillJob
+  {
+    QString id;
+    PendingSpill spill;
+  };
+
+  static QString variantKey(const QString& id, const QSize& size);
+  static QSize scaledSize(const QSize& originalSize, const QSize& requestedSize);
+  QImage lookup(const QString& id, QSize* size, const QSize& requestedSize);
+  QImage cachedOriginal(const QString& id);
+  void store(const QString& key, const QImage& image, const QString& originalId);
+  void remove(const QString& key);
+  void removeVariants(const QString& id);
+  void discardSpill(const QString& id);
+  void evict();
+  void writeSpills();
+  void notifyStatisticsChanged();
+  QString spillPath(const QString& id, quint64 generation) const;
+
+  mutable QMutex m_mutex;
+  QHash<QString, Entry> m_entries;
+  std::list<QString> m_lru;
+  QHash<QString, QStringList> m_variants;
+  QHash<QString, PendingSpill> m_pendingSpills;
+  QHash<QString, QString> m_spilled;
+  // sizes of all originals that can still be served, in memory or spilled
+  QHash<QString, QSize> m_originalSizes;
+  // disk work queued while the lock was held, done by writeSpills()
+  QList<SpillJob> m_spillQueue;
+  QStringList m_obsoleteFiles;
+  std::unique_ptr<QTemporaryDir> m_spillDirectory;
+  bool m_spillingEnabled = false;
+  quint64 m_spillGeneration = 0;
+  qint64 m_byteBudget = defaultByteBudget;
+  Statistics m_statistics;
+  mutable bool m_notificationPending = false;
+};
+
+#endif // IMAGECACHE_H
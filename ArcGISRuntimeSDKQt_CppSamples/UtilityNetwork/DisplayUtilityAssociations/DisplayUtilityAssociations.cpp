@@ -22,8 +22,9 @@
 #include "SymbolImageProvider.h"
 
 #include "ArcGISFeatureTable.h"
-#include "AttributeListModel.h"
 #include "FeatureLayer.h"
+#include "Graphic.h"
+#include "GraphicListModel.h"
 #include "GraphicsOverlay.h"
 #include "Map.h"
 #include "MapQuickView.h"
@@ -36,9 +37,11 @@
 #include "UtilityNetworkSource.h"
 #include "UtilityNetworkTypes.h"
 
+#include <QElapsedTimer>
 #include <QList>
 #include <QImage>
 #include <QQmlContext>
+#include <QSet>
 
 using namespace Esri::ArcGISRuntime;
 
@@ -47,6 +50,15 @@ namespace
 const QString featureServerUrl("https://sampleserver7.arcgisonline.com/server/rest/services/UtilityNetwork/NapervilleElectric/FeatureServer");
 const int maxScale = 2000;
 constexpr int targetScale = 50;
+
+// associations are kept while they are within this many view widths/heights of the view
+constexpr double retainedViewMargin = 1.0;
+
+bool envelopesIntersect(const Envelope& a, const Envelope& b)
+{
+  return a.xMin() <= b.xMax() && b.xMin() <= a.xMax() &&
+         a.yMin() <= b.yMax() && b.yMin() <= a.yMax();
+}
 }
 DisplayUtilityAssociations::DisplayUtilityAssociations(QObject* parent /* = nullptr */):
   QObject(parent),
@@ -79,6 +91,9 @@ void DisplayUtilityAssociations::addAssociations()
     return;
   }
 
+  // drop the associations that are now far outside the view
+  evictAssociationsOutside(extent);
+
   // get all the associations in the extent of the viewpoint
   m_utilityNetwork->associations(extent);
 }
@@ -113,6 +128,11 @@ void DisplayUtilityAssociations::setMapView(MapQuickView* mapView)
   m_symbolImageProvider = new SymbolImageProvider();
   engine->addImageProvider(SymbolImageProvider::imageProviderId(), m_symbolImageProvider);
 
+  // swatches evicted from the provider's memory budget are kept on disk, and
+  // the statistics are refreshed whenever the cache reports a change
+  m_symbolImageProvider->cache().enableSpilling("DisplayUtilityAssociations");
+  connect(&m_symbolImageProvider->cache(), &ImageCache::statisticsChanged, this, &DisplayUtilityAssociations::updateImageCacheStatistics);
+
   connect(m_mapView, &MapQuickView::setViewpointCompleted, this, [this](bool succeeded)
   {
     if (!succeeded)
@@ -197,29 +217,7 @@ void DisplayUtilityAssociations::connectSignals()
 
   connect(m_utilityNetwork, &UtilityNetwork::associationsCompleted, this, [this](QUuid, const QList<UtilityAssociation*>& associations)
   {
-    const GraphicListModel* graphics = m_associationsOverlay->graphics();
-
-    for (UtilityAssociation* association : associations)
-    {
-
-      // check if the graphics overlay already contains the association
-      const bool uniqueGraphic = std::none_of(graphics->begin(), graphics->end(), [=](const Graphic* graphic)
-      {
-        const AttributeListModel* attributes = graphic->attributes();
-        return attributes->containsAttribute("GlobalId") && qvariant_cast<QUuid>((*graphic->attributes())["GlobalId"]) == association->globalId();
-      });
-
-      if (uniqueGraphic)
-      {
-        // add a graphic for the association
-        QVariantMap graphicAttributes;
-        graphicAttributes["GlobalId"] = association->globalId();
-        graphicAttributes["AssociationType"] = static_cast<int>(association->associationType());
-        Graphic* graphic = new Graphic(association->geometry(), graphicAttributes, this);
-
-        m_associationsOverlay->graphics()->append(graphic);
-      }
-    }
+    addAssociationGraphics(associations);
   });
 
   connect(m_attachmentSymbol, &Symbol::createSwatchCompleted, this, [this](QUuid id, QImage image)
@@ -259,6 +257,80 @@ void DisplayUtilityAssociations::connectSignals()
   });
 }
 
+void DisplayUtilityAssociations::addAssociationGraphics(const QList<UtilityAssociation*>& associations)
+{
+  QElapsedTimer timer;
+  timer.start();
+
+  QList<Graphic*> newGraphics;
+  for (UtilityAssociation* association : associations)
+  {
+    // check if the graphics overlay already contains the association
+    const QUuid globalId = association->globalId();
+    if (m_associationIndex.contains(globalId))
+      continue;
+
+    // add a graphic for the association
+    QVariantMap graphicAttributes;
+    graphicAttributes["GlobalId"] = globalId;
+    graphicAttributes["AssociationType"] = static_cast<int>(association->associationType());
+    const Geometry geometry = association->geometry();
+    Graphic* graphic = new Graphic(geometry, graphicAttributes, this);
+
+    m_associationIndex.insert(globalId, IndexedAssociation{graphic, geometry.extent()});
+    newGraphics.append(graphic);
+  }
+
+  // add the new graphics to the overlay in one call
+  if (!newGraphics.isEmpty())
+    m_associationsOverlay->graphics()->append(newGraphics);
+
+  m_lastBatchTime = timer.nsecsElapsed() / 1.0e6;
+  emit associationStatisticsChanged();
+}
+
+void DisplayUtilityAssociations::evictAssociationsOutside(const Envelope& extent)
+{
+  const double marginX = extent.width() * retainedViewMargin;
+  const double marginY = extent.height() * retainedViewMargin;
+  const Envelope retainedExtent(extent.xMin() - marginX, extent.yMin() - marginY,
+                                extent.xMax() + marginX, extent.yMax() + marginY,
+                                extent.spatialReference());
+
+  QSet<Graphic*> evicted;
+  for (auto it = m_associationIndex.begin(); it != m_associationIndex.end();)
+  {
+    if (envelopesIntersect(it->extent, retainedExtent))
+    {
+      ++it;
+      continue;
+    }
+
+    evicted.insert(it->graphic);
+    it = m_associationIndex.erase(it);
+  }
+
+  if (evicted.isEmpty())
+    return;
+
+  // remove only the evicted rows, walking the model backwards so each run of
+  // contiguous evicted rows is removed without shifting the rows still to visit
+  // and retained graphics keep their rows
+  GraphicListModel* graphics = m_associationsOverlay->graphics();
+  int remaining = evicted.size();
+  for (int row = graphics->size() - 1; row >= 0 && remaining > 0; --row)
+  {
+    if (!evicted.contains(graphics->at(row)))
+      continue;
+
+    graphics->removeAt(row);
+    --remaining;
+  }
+
+  qDeleteAll(evicted);
+  emit associationStatisticsChanged();
+}
+
 QString DisplayUtilityAssociations::attachmentSymbolUrl() const
 {
   return m_attachmentSymbolUrl;
@@ -268,3 +340,31 @@ QString DisplayUtilityAssociations::connectivitySymbolUrl() const
 {
   return m_connectivitySymbolUrl;
 }
+
+int DisplayUtilityAssociations::associationCount() const
+{
+  return m_associationIndex.size();
+}
+
+double DisplayUtilityAssociations::lastBatchTime() const
+{
+  return m_lastBatchTime;
+}
+
+QString DisplayUtilityAssociations::imageCacheStatistics() const
+{
+  return m_imageCacheStatistics;
+}
+
+void DisplayUtilityAssociations::updateImageCacheStatistics()
+{
+  if (!m_symbolImageProvider)
+    return;
+
+  const QString statistics = m_symbolImageProvider->cache().statistics().toString();
+  if (statistics == m_imageCacheStatistics)
+    return;
+
+  m_imageCacheStatistics = statistics;
+  emit imageCacheStatisticsChanged();
+}
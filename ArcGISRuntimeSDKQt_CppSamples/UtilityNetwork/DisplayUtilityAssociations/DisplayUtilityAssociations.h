@@ -17,19 +17,24 @@
 #ifndef DISPLAYUTILITYASSOCIATIONS_H
 #define DISPLAYUTILITYASSOCIATIONS_H
 
+#include "Envelope.h"
 #include "UtilityNetworkTypes.h"
 
+#include <QHash>
 #include <QObject>
+#include <QUuid>
 
 namespace Esri
 {
 namespace ArcGISRuntime
 {
 class Credential;
+class Graphic;
 class GraphicsOverlay;
 class Map;
 class MapQuickView;
 class Symbol;
+class UtilityAssociation;
 class UtilityNetwork;
 }
 }
@@ -43,6 +48,9 @@ class DisplayUtilityAssociations : public QObject
   Q_PROPERTY(Esri::ArcGISRuntime::MapQuickView* mapView READ mapView WRITE setMapView NOTIFY mapViewChanged)
   Q_PROPERTY(QString attachmentSymbolUrl READ attachmentSymbolUrl NOTIFY attachmentSymbolUrlChanged)
   Q_PROPERTY(QString connectivitySymbolUrl READ connectivitySymbolUrl NOTIFY connectivitySymbolUrlChanged)
+  Q_PROPERTY(int associationCount READ associationCount NOTIFY associationStatisticsChanged)
+  Q_PROPERTY(double lastBatchTime READ lastBatchTime NOTIFY associationStatisticsChanged)
+  Q_PROPERTY(QString imageCacheStatistics READ imageCacheStatistics NOTIFY imageCacheStatisticsChanged)
 
 public:
   explicit DisplayUtilityAssociations(QObject* parent = nullptr);
@@ -54,14 +62,29 @@ signals:
   void mapViewChanged();
   void attachmentSymbolUrlChanged();
   void connectivitySymbolUrlChanged();
+  void associationStatisticsChanged();
+  void imageCacheStatisticsChanged();
 
 private:
+  // an association's graphic and the extent of its geometry
+  struct IndexedAssociation
+  {
+    Esri::ArcGISRuntime::Graphic* graphic = nullptr;
+    Esri::ArcGISRuntime::Envelope extent;
+  };
+
   Esri::ArcGISRuntime::MapQuickView* mapView() const;
   void setMapView(Esri::ArcGISRuntime::MapQuickView* mapView);
   void addAssociations();
   QString attachmentSymbolUrl() const;
   QString connectivitySymbolUrl() const;
+  int associationCount() const;
+  double lastBatchTime() const;
+  QString imageCacheStatistics() const;
+  void updateImageCacheStatistics();
   void connectSignals();
+  void addAssociationGraphics(const QList<Esri::ArcGISRuntime::UtilityAssociation*>& associations);
+  void evictAssociationsOutside(const Esri::ArcGISRuntime::Envelope& extent);
 
   Esri::ArcGISRuntime::Map* m_map = nullptr;
   Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
@@ -73,6 +96,10 @@ private:
   QString m_attachmentSymbolUrl = "";
   QString m_connectivitySymbolUrl = "";
   SymbolImageProvider* m_symbolImageProvider = nullptr;
+  QString m_imageCacheStatistics;
+  // graphics in m_associationsOverlay keyed by the association's global id
+  QHash<QUuid, IndexedAssociation> m_associationIndex;
+  double m_lastBatchTime = 0.0;
 };
 
 #endif // DISPLAYUTILITYASSOCIATIONS_H
@@ -70,6 +70,16 @@ Item {
                     text: "Connectivity symbol"
                     visible: model.attachmentSymbolUrl !== "" && model.connectivitySymbolUrl !== ""
                 }
+
+                Label {
+                    text: "%1 associations (last batch %2 ms)".arg(model.associationCount).arg(model.lastBatchTime.toFixed(1))
+                    Layout.columnSpan: 2
+                }
+
+                Label {
+                    text: "Swatch cache: " + model.imageCacheStatistics
+                    Layout.columnSpan: 2
+                }
             }
         }
     }
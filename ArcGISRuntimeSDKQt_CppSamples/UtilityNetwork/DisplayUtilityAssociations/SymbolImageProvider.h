@@ -14,8 +14,9 @@
 #ifndef SYMBOLIMAGEPROVIDER_H
 #define SYMBOLIMAGEPROVIDER_H
 
+#include "ImageCache.h"
+
 // Qt headers
-#include <QHash>
 #include <QImage>
 #include <QQuickImageProvider>
 
@@ -29,10 +30,11 @@ public:
 public:
   QImage requestImage(const QString& id, QSize* size, const QSize& requestedSize) override;
   void addImage(const QString& id, const QImage& img);
+  ImageCache& cache();
   static QString imageProviderId();
 
 private:
-  QHash<QString, QImage> m_images;
+  ImageCache m_images;
 };
 
 #endif // SYMBOLIMAGEPROVIDER_H